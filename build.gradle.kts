@@ -1,6 +1,7 @@
 plugins {
     kotlin("jvm") version "1.9.22"
     `maven-publish`
+    id("me.champeau.jmh") version "0.7.2"
 }
 
 group = "dev.gbln"
@@ -24,18 +25,119 @@ dependencies {
 
 kotlin {
     jvmToolchain(17)
+
+    // Benchmarks call internal conversion code directly
+    target.compilations.getByName("jmh").associateWith(target.compilations.getByName("main"))
+}
+
+// VectorStructuralScanner uses the incubating Vector API. The module is
+// only needed at compile time; at runtime the scalar scanner takes over
+// unless the application adds it too.
+tasks.withType<org.jetbrains.kotlin.gradle.tasks.KotlinCompile>().configureEach {
+    compilerOptions.freeCompilerArgs.add("-Xadd-modules=jdk.incubator.vector")
+}
+
+// Benchmarks live in src/jmh/kotlin; run with ./gradlew jmh
+jmh {
+    jmhVersion.set("1.37")
+    resultFormat.set("JSON")
+    jvmArgsAppend.add("--add-modules=jdk.incubator.vector")
+}
+
+// Time to first parse across 20 fresh JVMs; results in build/reports/jmh
+tasks.register<JavaExec>("coldStartBenchmark") {
+    group = "benchmark"
+    description = "Measures time to first parse in fresh JVMs."
+    val jmhJar = tasks.named<Jar>("jmhJar").flatMap { it.archiveFile }
+    inputs.file(jmhJar)
+    classpath(jmhJar)
+    mainClass.set("org.openjdk.jmh.Main")
+    args(
+        "ColdStartBenchmark",
+        "-rf", "json",
+        "-rff", layout.buildDirectory.file("reports/jmh/cold-start.json").get().asFile.path
+    )
+    doFirst { layout.buildDirectory.dir("reports/jmh").get().asFile.mkdirs() }
 }
 
 tasks.test {
     useJUnitPlatform()
+    jvmArgs("--add-modules", "jdk.incubator.vector")
+}
+
+// java.lang.foreign backend, compiled for JDK 22 and shipped as a
+// multi-release JAR layer so JDK 17-21 keep using JNA
+val java22 by sourceSets.creating {
+    compileClasspath += sourceSets.main.get().output + sourceSets.main.get().compileClasspath
+}
+
+tasks.named<JavaCompile>("compileJava22Java") {
+    javaCompiler.set(javaToolchains.compilerFor { languageVersion.set(JavaLanguageVersion.of(22)) })
+    options.release.set(22)
+}
+
+dependencies {
+    // Lets the backend benchmark pick Panama when run on JDK 22+
+    "jmhRuntimeOnly"(java22.output)
+}
+
+// The test suite again on JDK 22 with the Panama backend forced, so the
+// java22 layer is exercised by check like the JNA backends are
+val testPanama by tasks.registering(Test::class) {
+    group = "verification"
+    description = "Runs the tests on JDK 22 with -Dgbln.backend=panama."
+    testClassesDirs = sourceSets.test.get().output.classesDirs
+    classpath = sourceSets.test.get().runtimeClasspath + java22.output
+    javaLauncher.set(javaToolchains.launcherFor { languageVersion.set(JavaLanguageVersion.of(22)) })
+    useJUnitPlatform()
+    jvmArgs("--add-modules", "jdk.incubator.vector", "--enable-native-access=ALL-UNNAMED")
+    systemProperty("gbln.backend", "panama")
+}
+
+tasks.check {
+    dependsOn(testPanama)
+}
+
+val nativeLibs = fileTree("../../core/ffi/libs") {
+    include("**/*.so")
+    include("**/*.dylib")
+    include("**/*.dll")
+}
+
+// SHA-256 sidecar per bundled library, so the runtime library cache knows
+// the expected hash without hashing the resource inside the JAR
+val nativeLibHashes by tasks.registering {
+    val outputDir = layout.buildDirectory.dir("generated/native-hashes")
+    inputs.files(nativeLibs)
+    outputs.dir(outputDir)
+
+    doLast {
+        val out = outputDir.get().asFile
+        out.deleteRecursively()
+        nativeLibs.visit {
+            if (!isDirectory) {
+                val digest = java.security.MessageDigest.getInstance("SHA-256").digest(file.readBytes())
+                val sidecar = out.resolve("$relativePath.sha256")
+                sidecar.parentFile.mkdirs()
+                sidecar.writeText(digest.joinToString("") { "%02x".format(it) } + "\n")
+            }
+        }
+    }
 }
 
 // Include pre-built libraries from core/ffi/libs/ in JAR
 tasks.jar {
-    from("../../core/ffi/libs") {
-        include("**/*.so")
-        include("**/*.dylib")
-        include("**/*.dll")
+    into("META-INF/versions/22") {
+        from(java22.output)
+    }
+    manifest {
+        attributes("Multi-Release" to "true")
+    }
+
+    from(nativeLibs) {
+        into("native")
+    }
+    from(nativeLibHashes) {
         into("native")
     }
 }
@@ -1 +1,6 @@
+plugins {
+    // Provisions the JDK 22 toolchain of the java22 source set on demand
+    id("org.gradle.toolchains.foojay-resolver-convention") version "0.8.0"
+}
+
 rootProject.name = "gbln-kotlin"
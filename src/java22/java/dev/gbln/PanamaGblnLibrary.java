@@ -0,0 +1,552 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln;
+
+import com.sun.jna.Pointer;
+import com.sun.jna.ptr.LongByReference;
+import com.sun.jna.ptr.PointerByReference;
+
+import java.lang.foreign.Arena;
+import java.lang.foreign.FunctionDescriptor;
+import java.lang.foreign.Linker;
+import java.lang.foreign.MemoryLayout;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.SymbolLookup;
+import java.lang.invoke.MethodHandle;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+
+import static java.lang.foreign.ValueLayout.ADDRESS;
+import static java.lang.foreign.ValueLayout.JAVA_BOOLEAN;
+import static java.lang.foreign.ValueLayout.JAVA_BYTE;
+import static java.lang.foreign.ValueLayout.JAVA_DOUBLE;
+import static java.lang.foreign.ValueLayout.JAVA_FLOAT;
+import static java.lang.foreign.ValueLayout.JAVA_INT;
+import static java.lang.foreign.ValueLayout.JAVA_LONG;
+import static java.lang.foreign.ValueLayout.JAVA_SHORT;
+
+/**
+ * libgbln binding on java.lang.foreign (JDK 22+).
+ *
+ * Packaged under META-INF/versions/22 of the multi-release JAR and picked
+ * up by Ffi.kt when running on JDK 22 or newer. Downcall handles are
+ * static finals so the JIT can inline them; pointers cross the GblnLibrary
+ * interface as JNA Pointers so the rest of the binding is unchanged.
+ *
+ * Returned C strings are decoded straight from a MemorySegment via
+ * NativeStringReader instead of JNA's Pointer.getString. String arguments
+ * (keys, paths, small documents) are encoded into a per-thread buffer
+ * and out-parameters use a per-thread slot, so only large documents
+ * passed as Strings get an Arena of their own.
+ */
+public final class PanamaGblnLibrary implements GblnLibrary, NativeStringReader {
+
+    private static final Linker LINKER = Linker.nativeLinker();
+    private static final SymbolLookup LOOKUP = lookup(FfiKt.getLibraryName());
+
+    // Parser
+    private static final MethodHandle PARSE = downcall("gbln_parse", JAVA_INT, ADDRESS, ADDRESS);
+    private static final MethodHandle PARSE_FILE = downcall("gbln_parse_file", JAVA_INT, ADDRESS, ADDRESS);
+
+    // Serialiser
+    private static final MethodHandle TO_STRING = downcall("gbln_to_string", ADDRESS, ADDRESS);
+    private static final MethodHandle TO_STRING_PRETTY = downcall("gbln_to_string_pretty", ADDRESS, ADDRESS);
+    private static final MethodHandle WRITE_FILE = downcall("gbln_write_file", JAVA_INT, ADDRESS, ADDRESS);
+
+    // Memory
+    private static final MethodHandle VALUE_FREE = downcallVoid("gbln_value_free", ADDRESS);
+
+    // Type query
+    private static final MethodHandle VALUE_TYPE = downcall("gbln_value_type", JAVA_INT, ADDRESS);
+
+    // Value getters (with ok flag)
+    private static final MethodHandle AS_I8 = downcall("gbln_value_as_i8", JAVA_BYTE, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_I16 = downcall("gbln_value_as_i16", JAVA_SHORT, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_I32 = downcall("gbln_value_as_i32", JAVA_INT, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_I64 = downcall("gbln_value_as_i64", JAVA_LONG, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_U8 = downcall("gbln_value_as_u8", JAVA_BYTE, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_U16 = downcall("gbln_value_as_u16", JAVA_SHORT, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_U32 = downcall("gbln_value_as_u32", JAVA_INT, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_U64 = downcall("gbln_value_as_u64", JAVA_LONG, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_F32 = downcall("gbln_value_as_f32", JAVA_FLOAT, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_F64 = downcall("gbln_value_as_f64", JAVA_DOUBLE, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_BOOL = downcall("gbln_value_as_bool", JAVA_BOOLEAN, ADDRESS, ADDRESS);
+    private static final MethodHandle AS_STRING = downcall("gbln_value_as_string", ADDRESS, ADDRESS, ADDRESS);
+
+    // Object operations
+    private static final MethodHandle OBJECT_GET = downcall("gbln_object_get", ADDRESS, ADDRESS, ADDRESS);
+    private static final MethodHandle OBJECT_LEN = downcall("gbln_object_len", JAVA_LONG, ADDRESS);
+    private static final MethodHandle OBJECT_KEYS = downcall("gbln_object_keys", ADDRESS, ADDRESS, ADDRESS);
+
+    // Array operations
+    private static final MethodHandle ARRAY_GET = downcall("gbln_array_get", ADDRESS, ADDRESS, JAVA_LONG);
+    private static final MethodHandle ARRAY_LEN = downcall("gbln_array_len", JAVA_LONG, ADDRESS);
+
+    // I/O operations
+    private static final MethodHandle READ_IO = downcall("gbln_read_io", JAVA_INT, ADDRESS, ADDRESS);
+    private static final MethodHandle WRITE_IO = downcall("gbln_write_io", JAVA_INT, ADDRESS, ADDRESS, ADDRESS);
+
+    // Configuration
+    private static final MethodHandle CONFIG_NEW = downcall("gbln_config_new", ADDRESS,
+            JAVA_BOOLEAN, JAVA_BOOLEAN, JAVA_INT, JAVA_INT, JAVA_BOOLEAN);
+    private static final MethodHandle CONFIG_NEW_IO = downcall("gbln_config_new_io", ADDRESS);
+    private static final MethodHandle CONFIG_FREE = downcallVoid("gbln_config_free", ADDRESS);
+
+    // Error handling
+    private static final MethodHandle LAST_ERROR_MESSAGE = downcall("gbln_last_error_message", ADDRESS);
+    private static final MethodHandle STRING_FREE = downcallVoid("gbln_string_free", ADDRESS);
+
+    /** Per-thread slot for ok flags and out-parameters. */
+    private static final ThreadLocal<MemorySegment> SCRATCH =
+            ThreadLocal.withInitial(() -> Arena.ofAuto().allocate(JAVA_LONG));
+
+    /** Longest string argument kept in the per-thread buffer. */
+    private static final int MAX_CACHED_STRING = 64 * 1024;
+
+    /** Per-thread buffer for one NUL-terminated string argument. */
+    private static final ThreadLocal<MemorySegment[]> STRINGS =
+            ThreadLocal.withInitial(() -> new MemorySegment[] { Arena.ofAuto().allocate(256) });
+
+    private static SymbolLookup lookup(String name) {
+        Path path = Path.of(name);
+        if (Files.exists(path)) {
+            return SymbolLookup.libraryLookup(path, Arena.global());
+        }
+        return SymbolLookup.libraryLookup(System.mapLibraryName(name), Arena.global());
+    }
+
+    private static MemorySegment symbol(String name) {
+        return LOOKUP.find(name).orElseThrow(() -> new UnsatisfiedLinkError("Symbol not found: " + name));
+    }
+
+    private static MethodHandle downcall(String name, MemoryLayout result, MemoryLayout... args) {
+        return LINKER.downcallHandle(symbol(name), FunctionDescriptor.of(result, args));
+    }
+
+    private static MethodHandle downcallVoid(String name, MemoryLayout... args) {
+        return LINKER.downcallHandle(symbol(name), FunctionDescriptor.ofVoid(args));
+    }
+
+    private static MemorySegment segment(Pointer pointer) {
+        return pointer == null ? MemorySegment.NULL : MemorySegment.ofAddress(Pointer.nativeValue(pointer));
+    }
+
+    /**
+     * {@code value} as NUL-terminated UTF-8 in the calling thread's buffer,
+     * valid until its next call. Rare long strings get their own segment.
+     */
+    private static MemorySegment cString(String value) {
+        byte[] bytes = value.getBytes(StandardCharsets.UTF_8);
+        if (bytes.length >= MAX_CACHED_STRING) {
+            return Arena.ofAuto().allocateFrom(value);
+        }
+        MemorySegment[] slot = STRINGS.get();
+        MemorySegment buffer = slot[0];
+        if (buffer.byteSize() <= bytes.length) {
+            buffer = Arena.ofAuto().allocate(Math.max(bytes.length + 1L, buffer.byteSize() * 2));
+            slot[0] = buffer;
+        }
+        MemorySegment.copy(bytes, 0, buffer, JAVA_BYTE, 0, bytes.length);
+        buffer.set(JAVA_BYTE, bytes.length, (byte) 0);
+        return buffer;
+    }
+
+    private static Pointer pointer(MemorySegment segment) {
+        long address = segment.address();
+        return address == 0L ? null : new Pointer(address);
+    }
+
+    private static RuntimeException rethrow(Throwable t) {
+        if (t instanceof RuntimeException e) {
+            return e;
+        }
+        if (t instanceof Error e) {
+            throw e;
+        }
+        return new IllegalStateException(t);
+    }
+
+    private static void setOk(MemorySegment scratch, byte[] ok) {
+        ok[0] = scratch.get(JAVA_BYTE, 0);
+    }
+
+    @Override
+    public String readUtf8(long address) {
+        return MemorySegment.ofAddress(address).reinterpret(Long.MAX_VALUE).getString(0);
+    }
+
+    // Parser
+
+    @Override
+    public int gbln_parse(String input, PointerByReference outValue) {
+        // Whole documents can be large: free them right after the call
+        if (input.length() >= MAX_CACHED_STRING) {
+            try (Arena arena = Arena.ofConfined()) {
+                return parse(arena.allocateFrom(input), outValue);
+            }
+        }
+        return parse(cString(input), outValue);
+    }
+
+    @Override
+    public int gbln_parse(Pointer input, PointerByReference outValue) {
+        return parse(segment(input), outValue);
+    }
+
+    private static int parse(MemorySegment input, PointerByReference outValue) {
+        MemorySegment out = SCRATCH.get();
+        try {
+            int err = (int) PARSE.invokeExact(input, out);
+            outValue.setValue(pointer(out.get(ADDRESS, 0)));
+            return err;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public int gbln_parse_file(String path, PointerByReference outValue) {
+        MemorySegment out = SCRATCH.get();
+        try {
+            int err = (int) PARSE_FILE.invokeExact(cString(path), out);
+            outValue.setValue(pointer(out.get(ADDRESS, 0)));
+            return err;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Serialiser
+
+    @Override
+    public Pointer gbln_to_string(Pointer value) {
+        try {
+            return pointer((MemorySegment) TO_STRING.invokeExact(segment(value)));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public Pointer gbln_to_string_pretty(Pointer value) {
+        try {
+            return pointer((MemorySegment) TO_STRING_PRETTY.invokeExact(segment(value)));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public int gbln_write_file(String path, Pointer value) {
+        try {
+            return (int) WRITE_FILE.invokeExact(cString(path), segment(value));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Memory
+
+    @Override
+    public void gbln_value_free(Pointer value) {
+        try {
+            VALUE_FREE.invokeExact(segment(value));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Type query
+
+    @Override
+    public int gbln_value_type(Pointer value) {
+        try {
+            return (int) VALUE_TYPE.invokeExact(segment(value));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Value getters (with ok flag)
+
+    @Override
+    public byte gbln_value_as_i8(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            byte result = (byte) AS_I8.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public short gbln_value_as_i16(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            short result = (short) AS_I16.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public int gbln_value_as_i32(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            int result = (int) AS_I32.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public long gbln_value_as_i64(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            long result = (long) AS_I64.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public short gbln_value_as_u8(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            byte result = (byte) AS_U8.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return (short) (result & 0xFF);
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public int gbln_value_as_u16(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            short result = (short) AS_U16.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result & 0xFFFF;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public long gbln_value_as_u32(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            int result = (int) AS_U32.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result & 0xFFFFFFFFL;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public long gbln_value_as_u64(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            long result = (long) AS_U64.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public float gbln_value_as_f32(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            float result = (float) AS_F32.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public double gbln_value_as_f64(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            double result = (double) AS_F64.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public byte gbln_value_as_bool(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            boolean result = (boolean) AS_BOOL.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return result ? (byte) 1 : (byte) 0;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public Pointer gbln_value_as_string(Pointer value, byte[] ok) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            MemorySegment result = (MemorySegment) AS_STRING.invokeExact(segment(value), scratch);
+            setOk(scratch, ok);
+            return pointer(result);
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Object operations
+
+    @Override
+    public Pointer gbln_object_get(Pointer obj, String key) {
+        try {
+            return pointer((MemorySegment) OBJECT_GET.invokeExact(segment(obj), cString(key)));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public Pointer gbln_object_get(Pointer obj, Pointer key) {
+        try {
+            return pointer((MemorySegment) OBJECT_GET.invokeExact(segment(obj), segment(key)));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public long gbln_object_len(Pointer obj) {
+        try {
+            return (long) OBJECT_LEN.invokeExact(segment(obj));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public Pointer gbln_object_keys(Pointer obj, LongByReference outCount) {
+        MemorySegment scratch = SCRATCH.get();
+        try {
+            MemorySegment result = (MemorySegment) OBJECT_KEYS.invokeExact(segment(obj), scratch);
+            outCount.setValue(scratch.get(JAVA_LONG, 0));
+            return pointer(result);
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Array operations
+
+    @Override
+    public Pointer gbln_array_get(Pointer array, long index) {
+        try {
+            return pointer((MemorySegment) ARRAY_GET.invokeExact(segment(array), index));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public long gbln_array_len(Pointer array) {
+        try {
+            return (long) ARRAY_LEN.invokeExact(segment(array));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // I/O operations
+
+    @Override
+    public int gbln_read_io(String path, PointerByReference outValue) {
+        MemorySegment out = SCRATCH.get();
+        try {
+            int err = (int) READ_IO.invokeExact(cString(path), out);
+            outValue.setValue(pointer(out.get(ADDRESS, 0)));
+            return err;
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public int gbln_write_io(Pointer value, String path, Pointer config) {
+        try {
+            return (int) WRITE_IO.invokeExact(segment(value), cString(path), segment(config));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Configuration
+
+    @Override
+    public Pointer gbln_config_new(boolean miniMode, boolean compress, int compressionLevel, int indent,
+                                   boolean stripComments) {
+        try {
+            return pointer((MemorySegment) CONFIG_NEW.invokeExact(
+                    miniMode, compress, compressionLevel, indent, stripComments));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public Pointer gbln_config_new_io() {
+        try {
+            return pointer((MemorySegment) CONFIG_NEW_IO.invokeExact());
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public void gbln_config_free(Pointer config) {
+        try {
+            CONFIG_FREE.invokeExact(segment(config));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    // Error handling
+
+    @Override
+    public Pointer gbln_last_error_message() {
+        try {
+            return pointer((MemorySegment) LAST_ERROR_MESSAGE.invokeExact());
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+
+    @Override
+    public void gbln_string_free(Pointer str) {
+        try {
+            STRING_FREE.invokeExact(segment(str));
+        } catch (Throwable t) {
+            throw rethrow(t);
+        }
+    }
+}
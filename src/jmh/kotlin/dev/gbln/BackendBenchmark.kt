@@ -0,0 +1,54 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.openjdk.jmh.annotations.Benchmark
+import org.openjdk.jmh.annotations.BenchmarkMode
+import org.openjdk.jmh.annotations.Fork
+import org.openjdk.jmh.annotations.Level
+import org.openjdk.jmh.annotations.Measurement
+import org.openjdk.jmh.annotations.Mode
+import org.openjdk.jmh.annotations.OutputTimeUnit
+import org.openjdk.jmh.annotations.Param
+import org.openjdk.jmh.annotations.Scope
+import org.openjdk.jmh.annotations.Setup
+import org.openjdk.jmh.annotations.State
+import org.openjdk.jmh.annotations.Warmup
+import java.util.concurrent.TimeUnit
+
+/**
+ * FFI backends compared on per-node conversion.
+ *
+ * Conversion costs several FFI calls per node, so the binding overhead
+ * dominates; each backend runs in its own forked JVM. The panama case
+ * needs the benchmark JVM to be JDK 22+ and fails its setup otherwise.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(2)
+open class BackendBenchmark {
+
+    @Param("panama", "direct", "jna")
+    lateinit var backend: String
+
+    private lateinit var records: ManagedGblnValue
+
+    @Setup(Level.Trial)
+    fun setup() {
+        System.setProperty("gbln.backend", backend)
+        check(gblnBackend.name.equals(backend, ignoreCase = true)) {
+            "Requested $backend backend but loaded $gblnBackend"
+        }
+        records = parseRaw(Fixtures.records(1_000))
+    }
+
+    @Benchmark
+    fun parseSmall(): Any? = parse(Fixtures.SMALL)
+
+    @Benchmark
+    fun convertRecords(): Any? = walkToKotlin(records.ptr)
+}
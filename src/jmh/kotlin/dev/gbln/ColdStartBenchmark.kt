@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.openjdk.jmh.annotations.Benchmark
+import org.openjdk.jmh.annotations.BenchmarkMode
+import org.openjdk.jmh.annotations.Fork
+import org.openjdk.jmh.annotations.Measurement
+import org.openjdk.jmh.annotations.Mode
+import org.openjdk.jmh.annotations.OutputTimeUnit
+import org.openjdk.jmh.annotations.Scope
+import org.openjdk.jmh.annotations.State
+import org.openjdk.jmh.annotations.Warmup
+import java.util.concurrent.TimeUnit
+
+/**
+ * Time to first parse in a fresh JVM.
+ *
+ * Every fork runs exactly one invocation, so each sample includes library
+ * location, binding, class loading and interpreted conversion: what the
+ * first request after a deploy pays. withWarmup shows the same first
+ * parse after Gbln.warmup(), with the warmup itself included in the time.
+ * Run with ./gradlew coldStartBenchmark.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.SingleShotTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 0)
+@Measurement(iterations = 1)
+@Fork(20)
+open class ColdStartBenchmark {
+
+    @Benchmark
+    fun firstParse(): Any? = parse(Fixtures.SMALL)
+
+    @Benchmark
+    fun withWarmup(): Any? {
+        Gbln.warmup()
+        return parse(Fixtures.SMALL)
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+/**
+ * Synthetic documents shared by the benchmarks.
+ */
+internal object Fixtures {
+
+    /** A single small record, typical of high-rate request payloads. */
+    const val SMALL = "user{id<u32>(12345)name<s64>(Alice)age<i8>(25)active<b>(t)score<f32>(98.5)}"
+
+    /** SMALL with an out-of-range i8, rejected by the parser. */
+    const val INVALID = "user{id<u32>(12345)name<s64>(Alice)age<i8>(999)active<b>(t)score<f32>(98.5)}"
+
+    /** Body of src/test/resources/fixtures/valid/simple.gbln. */
+    const val SIMPLE = """user{
+    id<u32>(12345)
+    name<s64>(Alice)
+    age<i8>(25)
+    active<b>(t)
+}"""
+
+    /** Body of src/test/resources/fixtures/valid/nested.gbln. */
+    const val NESTED = """config{
+    database{
+        host<s64>(localhost)
+        port<u16>(5432)
+        credentials{
+            username<s32>(admin)
+            password<s64>(secret123)
+        }
+    }
+    server{
+        host<s64>(0.0.0.0)
+        port<u16>(8080)
+        workers<u8>(4)
+    }
+}"""
+
+    /** Body of src/test/resources/fixtures/valid/types.gbln. */
+    const val TYPES = """types{
+    :| Signed integers
+    i8_val<i8>(-128)
+    i16_val<i16>(-32768)
+    i32_val<i32>(-2147483648)
+    i64_val<i64>(-9223372036854775808)
+
+    :| Unsigned integers
+    u8_val<u8>(255)
+    u16_val<u16>(65535)
+    u32_val<u32>(4294967295)
+    u64_val<u64>(18446744073709551615)
+
+    :| Floats
+    f32_val<f32>(3.14159)
+    f64_val<f64>(2.718281828459045)
+
+    :| String
+    str_val<s64>(Hello World!)
+
+    :| Boolean
+    bool_true<b>(t)
+    bool_false<b>(f)
+
+    :| Null
+    null_val<n>()
+}"""
+
+    /**
+     * [fixture] repeated until the document reaches [bytes], each copy
+     * under its own top-level key (`r0{...} r1{...}`) so it stays valid.
+     */
+    fun scaled(fixture: String, bytes: Int): String = buildString {
+        val body = fixture.substring(fixture.indexOf('{'))
+        var i = 0
+        while (length < bytes) {
+            append('r').append(i++).append(body).append('\n')
+        }
+    }
+
+    /**
+     * A top-level array of [count] homogeneous records (about eight nodes each).
+     */
+    fun records(count: Int): String = buildString {
+        append("users[")
+        for (i in 0 until count) {
+            append("{id<u32>(").append(i).append(')')
+            append("name<s32>(user").append(i).append(')')
+            append("age<i8>(").append(i % 100).append(')')
+            append("active<b>(").append(if (i % 2 == 0) 't' else 'f').append(')')
+            append("score<f64>(").append(i * 0.5).append(')')
+            append("tags<s16>[alpha beta gamma]}")
+        }
+        append(']')
+    }
+}
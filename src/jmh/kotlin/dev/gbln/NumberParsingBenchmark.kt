@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.openjdk.jmh.annotations.Benchmark
+import org.openjdk.jmh.annotations.BenchmarkMode
+import org.openjdk.jmh.annotations.Fork
+import org.openjdk.jmh.annotations.Level
+import org.openjdk.jmh.annotations.Measurement
+import org.openjdk.jmh.annotations.Mode
+import org.openjdk.jmh.annotations.OutputTimeUnit
+import org.openjdk.jmh.annotations.Param
+import org.openjdk.jmh.annotations.Scope
+import org.openjdk.jmh.annotations.Setup
+import org.openjdk.jmh.annotations.State
+import org.openjdk.jmh.annotations.Warmup
+import java.util.concurrent.TimeUnit
+import kotlin.random.Random
+
+/**
+ * Number decoding on a typed array of a million values.
+ *
+ * kernel runs GblnScalars over every token; jdk converts the same tokens
+ * with String.toLong/toDouble/toFloat for comparison; parse is the whole
+ * JVM engine on the `values<type>[...]` document. Results are per
+ * million numbers.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(2)
+open class NumberParsingBenchmark {
+
+    @Param("i32", "i64", "u64", "f32", "f64")
+    lateinit var type: String
+
+    @Param("1000000")
+    var count: Int = 0
+
+    private lateinit var document: ByteArray
+    private lateinit var starts: IntArray
+    private lateinit var ends: IntArray
+    private var valueType = 0
+
+    @Setup(Level.Trial)
+    fun setup() {
+        val random = Random(7)
+        val tokens = List(count) {
+            when (type) {
+                "i32" -> random.nextInt().toString()
+                "i64" -> random.nextLong().toString()
+                "u64" -> random.nextLong().toULong().toString()
+                // Prices and measurements: a few digits either side of the point
+                "f32" -> "%.2f".format(java.util.Locale.ROOT, random.nextDouble(0.0, 10_000.0))
+                else -> random.nextDouble(-1e6, 1e6).toString()
+            }
+        }
+        valueType = when (type) {
+            "i32" -> GblnValueType.I32
+            "i64" -> GblnValueType.I64
+            "u64" -> GblnValueType.U64
+            "f32" -> GblnValueType.F32
+            else -> GblnValueType.F64
+        }
+
+        val text = StringBuilder("values<$type>[")
+        starts = IntArray(count)
+        ends = IntArray(count)
+        tokens.forEachIndexed { i, token ->
+            if (i > 0) text.append(' ')
+            starts[i] = text.length
+            text.append(token)
+            ends[i] = text.length
+        }
+        document = text.append(']').toString().toByteArray(Charsets.US_ASCII)
+    }
+
+    @Benchmark
+    fun kernel(): Long {
+        var sum = 0L
+        for (i in starts.indices) {
+            sum += when (valueType) {
+                GblnValueType.F32 -> GblnScalars.parseFloat(document, starts[i], ends[i]).toRawBits().toLong()
+                GblnValueType.F64 -> GblnScalars.parseDouble(document, starts[i], ends[i]).toRawBits()
+                else -> GblnScalars.parseInteger(valueType, document, starts[i], ends[i])
+            }
+        }
+        return sum
+    }
+
+    @Benchmark
+    fun jdk(): Long {
+        var sum = 0L
+        for (i in starts.indices) {
+            val token = String(document, starts[i], ends[i] - starts[i], Charsets.ISO_8859_1)
+            sum += when (valueType) {
+                GblnValueType.F32 -> token.toFloat().toRawBits().toLong()
+                GblnValueType.F64 -> token.toDouble().toRawBits()
+                GblnValueType.U64 -> token.toULong().toLong()
+                else -> token.toLong()
+            }
+        }
+        return sum
+    }
+
+    @Benchmark
+    fun parse(): Int = JvmParser(document).parse().nodeCount
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.openjdk.jmh.annotations.Benchmark
+import org.openjdk.jmh.annotations.BenchmarkMode
+import org.openjdk.jmh.annotations.Fork
+import org.openjdk.jmh.annotations.Level
+import org.openjdk.jmh.annotations.Measurement
+import org.openjdk.jmh.annotations.Mode
+import org.openjdk.jmh.annotations.OutputTimeUnit
+import org.openjdk.jmh.annotations.Param
+import org.openjdk.jmh.annotations.Scope
+import org.openjdk.jmh.annotations.Setup
+import org.openjdk.jmh.annotations.State
+import org.openjdk.jmh.annotations.TearDown
+import org.openjdk.jmh.annotations.Warmup
+import java.util.concurrent.TimeUnit
+
+/**
+ * Throughput of rejecting invalid input.
+ *
+ * throwing with fastFail=false is the classic path (ParseError with a
+ * full stack trace); fastFail=true drops the stack trace; tryParse does
+ * not throw at all.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(2)
+open class RejectionBenchmark {
+
+    @Param("false", "true")
+    lateinit var fastFail: String
+
+    @Setup(Level.Trial)
+    fun setup() {
+        GblnErrors.fastFail = fastFail.toBoolean()
+    }
+
+    @TearDown(Level.Trial)
+    fun tearDown() {
+        GblnErrors.fastFail = false
+    }
+
+    @Benchmark
+    fun throwing(): Any? = try {
+        parse(Fixtures.INVALID)
+    } catch (e: ParseError) {
+        e.code
+    }
+
+    @Benchmark
+    fun tryParse(): Any? = when (val result = tryParse(Fixtures.INVALID)) {
+        is GblnParseResult.Success -> result.value
+        is GblnParseResult.Failure -> result.code
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Memory
+import com.sun.jna.Pointer
+import org.openjdk.jmh.annotations.Benchmark
+import org.openjdk.jmh.annotations.BenchmarkMode
+import org.openjdk.jmh.annotations.Fork
+import org.openjdk.jmh.annotations.Level
+import org.openjdk.jmh.annotations.Measurement
+import org.openjdk.jmh.annotations.Mode
+import org.openjdk.jmh.annotations.OutputTimeUnit
+import org.openjdk.jmh.annotations.Param
+import org.openjdk.jmh.annotations.Scope
+import org.openjdk.jmh.annotations.Setup
+import org.openjdk.jmh.annotations.State
+import org.openjdk.jmh.annotations.Warmup
+import org.openjdk.jmh.infra.Blackhole
+import java.util.concurrent.TimeUnit
+
+/**
+ * Reading NUL-terminated string values out of native memory, as the
+ * STRING branch of gblnToKotlin does.
+ *
+ * jna is Pointer.getString; scan is StringValues.read; dedup adds the
+ * dedup table. statuses are 4096 values drawn from eight short strings;
+ * latin1 and text are distinct values of about 40 bytes. Results are
+ * per 4096 values. Run with -prof gc to compare allocation.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(2)
+open class StringValueBenchmark {
+
+    @Param("statuses", "latin1", "text")
+    lateinit var values: String
+
+    private lateinit var memory: Memory
+    private lateinit var pointers: Array<Pointer>
+
+    @Setup(Level.Trial)
+    fun setup() {
+        val statuses = listOf("active", "pending", "closed", "DE", "FR", "US", "api.example.com", "n/a")
+        val strings = List(COUNT) {
+            when (values) {
+                "statuses" -> statuses[it % statuses.size]
+                "latin1" -> "Größe $it, Straße à Genève, café n°$it"
+                else -> "record $it: the quick brown fox jumps over"
+            }
+        }
+        val encoded = strings.map { it.toByteArray(Charsets.UTF_8) }
+        memory = Memory(encoded.sumOf { it.size + 1 }.toLong())
+        var offset = 0L
+        pointers = Array(COUNT) {
+            val bytes = encoded[it]
+            memory.write(offset, bytes, 0, bytes.size)
+            memory.setByte(offset + bytes.size, 0)
+            memory.share(offset).also { offset += bytes.size + 1 }
+        }
+    }
+
+    @Benchmark
+    fun jna(bh: Blackhole) {
+        for (p in pointers) bh.consume(p.getString(0, "UTF-8"))
+    }
+
+    @Benchmark
+    fun scan(bh: Blackhole) {
+        for (p in pointers) bh.consume(StringValues.read(p, dedup = false))
+    }
+
+    @Benchmark
+    fun dedup(bh: Blackhole) {
+        for (p in pointers) bh.consume(StringValues.read(p, dedup = true))
+    }
+
+    private companion object {
+        const val COUNT = 4096
+    }
+}
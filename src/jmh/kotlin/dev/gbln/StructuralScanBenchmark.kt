@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.openjdk.jmh.annotations.Benchmark
+import org.openjdk.jmh.annotations.BenchmarkMode
+import org.openjdk.jmh.annotations.Fork
+import org.openjdk.jmh.annotations.Level
+import org.openjdk.jmh.annotations.Measurement
+import org.openjdk.jmh.annotations.Mode
+import org.openjdk.jmh.annotations.OutputTimeUnit
+import org.openjdk.jmh.annotations.Param
+import org.openjdk.jmh.annotations.Scope
+import org.openjdk.jmh.annotations.Setup
+import org.openjdk.jmh.annotations.State
+import org.openjdk.jmh.annotations.Warmup
+import java.util.concurrent.TimeUnit
+
+/**
+ * Stage-one scanning and JVM-engine parsing of the fixture documents
+ * scaled to several megabytes.
+ *
+ * scan measures the structural index alone; parse is the whole JVM
+ * engine with the index (indexed) or byte-by-byte payload scanning
+ * (unindexed). Results are per document; divide by [megabytes] for MB/s.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(2)
+open class StructuralScanBenchmark {
+
+    @Param("simple", "nested", "types")
+    lateinit var fixture: String
+
+    @Param("4")
+    var megabytes: Int = 0
+
+    @Param("scalar", "vector")
+    lateinit var scanner: String
+
+    private lateinit var bytes: ByteArray
+    private lateinit var selected: StructuralScanner
+
+    @Setup(Level.Trial)
+    fun setup() {
+        val template = when (fixture) {
+            "simple" -> Fixtures.SIMPLE
+            "nested" -> Fixtures.NESTED
+            else -> Fixtures.TYPES
+        }
+        bytes = Fixtures.scaled(template, megabytes shl 20).toByteArray(Charsets.UTF_8)
+        selected = if (scanner == "scalar") ScalarStructuralScanner else structuralScanner
+        check(scanner == "scalar" || selected !== ScalarStructuralScanner) {
+            "jdk.incubator.vector is not available"
+        }
+    }
+
+    @Benchmark
+    fun scan(): Int = selected.scan(bytes, 0, bytes.size).size
+
+    @Benchmark
+    fun parseIndexed(): Int =
+        JvmParser(bytes, 0, bytes.size, selected.scan(bytes, 0, bytes.size)).parse().nodeCount
+
+    @Benchmark
+    fun parseUnindexed(): Int = JvmParser(bytes, 0, bytes.size).parse().nodeCount
+}
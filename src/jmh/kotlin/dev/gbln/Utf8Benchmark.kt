@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.openjdk.jmh.annotations.Benchmark
+import org.openjdk.jmh.annotations.BenchmarkMode
+import org.openjdk.jmh.annotations.Fork
+import org.openjdk.jmh.annotations.Level
+import org.openjdk.jmh.annotations.Measurement
+import org.openjdk.jmh.annotations.Mode
+import org.openjdk.jmh.annotations.OutputTimeUnit
+import org.openjdk.jmh.annotations.Param
+import org.openjdk.jmh.annotations.Scope
+import org.openjdk.jmh.annotations.Setup
+import org.openjdk.jmh.annotations.State
+import org.openjdk.jmh.annotations.Warmup
+import java.util.concurrent.TimeUnit
+
+/**
+ * UTF-8 validation and counting of string payloads, the check behind sN
+ * bounds.
+ *
+ * count runs the selected counter over 4096 payloads of [length] bytes;
+ * ascii payloads are plain English, mixed ones carry roughly one
+ * multi-byte character in eight. Results are per 4096 payloads.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(2)
+open class Utf8Benchmark {
+
+    @Param("16", "256", "4096")
+    var length: Int = 0
+
+    @Param("ascii", "mixed")
+    lateinit var text: String
+
+    @Param("swar", "vector")
+    lateinit var counter: String
+
+    private lateinit var bytes: ByteArray
+    private lateinit var selected: Utf8Counter
+
+    @Setup(Level.Trial)
+    fun setup() {
+        val unit = if (text == "ascii") "the quick brown fox " else "größe € 日本 😀 fox "
+        val payload = unit.repeat(length / unit.length + 1).toByteArray(Charsets.UTF_8)
+        // Cut at a character boundary at or below length
+        var end = length
+        while ((payload[end].toInt() and 0xC0) == 0x80) end--
+        bytes = ByteArray(COUNT * length)
+        repeat(COUNT) { System.arraycopy(payload, 0, bytes, it * length, end) }
+        selected = if (counter == "swar") SwarUtf8Counter else utf8Counter
+        check(counter == "swar" || selected !== SwarUtf8Counter) {
+            "jdk.incubator.vector is not available"
+        }
+    }
+
+    @Benchmark
+    fun count(): Int {
+        var total = 0
+        for (i in 0 until COUNT) {
+            total += selected.count(bytes, i * length, (i + 1) * length)
+        }
+        return total
+    }
+
+    private companion object {
+        const val COUNT = 4096
+    }
+}
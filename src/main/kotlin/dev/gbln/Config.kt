@@ -43,3 +43,93 @@ data class GblnConfig(
         }
     }
 }
+
+/**
+ * Options for converting parsed GBLN into Kotlin values.
+ *
+ * The defaults reproduce the classic result shapes: Map for objects,
+ * List for arrays, boxed numbers for scalars.
+ *
+ * @property primitiveArrays Materialise non-empty arrays whose elements all
+ *   share one numeric or bool type as primitive arrays instead of boxed
+ *   lists: i8 → ByteArray, i16/u8 → ShortArray, i32/u16 → IntArray,
+ *   i64/u32/u64 → LongArray, f32 → FloatArray, f64 → DoubleArray,
+ *   b → BooleanArray. Unsigned elements go into the narrowest signed
+ *   array that holds their whole range, so u8 and u16 arrays are narrower
+ *   than the Int their scalars convert to; u64 keeps its bit pattern, as
+ *   the scalar does. Default: false
+ * @property compactObjects Return objects as read-only, ordered maps that
+ *   store only their values and share one key "shape" with every other
+ *   object that has the same keys in the same order. Saves most of the
+ *   memory and construction time of arrays of records. Default: false
+ *   (mutable LinkedHashMap per object)
+ * @property engine Parser used by parse(), tryParse() and parseFile().
+ *   Default: GblnEngine.DEFAULT
+ * @property parallel Parse inputs of at least `gbln.parallelThreshold`
+ *   bytes (default 4 MiB) on several cores, splitting the largest array
+ *   or object between its elements. Same result and errors as a
+ *   sequential parse. JVM engine only. Default: false
+ * @property dedupStrings Return one shared instance for each distinct
+ *   string value of up to 32 bytes, through a bounded process-wide table
+ *   (`-Dgbln.dedupStrings=<slots>`, default 4096). Cuts the retained heap
+ *   and decode time of documents that repeat short values such as
+ *   statuses, country codes or hostnames. Default: false
+ *
+ * Example:
+ * ```kotlin
+ * val data = parse(telemetry, GblnParseOptions(primitiveArrays = true))
+ * val samples = (data as Map<*, *>)["samples"] as FloatArray
+ * ```
+ */
+data class GblnParseOptions(
+    val primitiveArrays: Boolean = false,
+    val compactObjects: Boolean = false,
+    val engine: GblnEngine = GblnEngine.DEFAULT,
+    val parallel: Boolean = false,
+    val dedupStrings: Boolean = false
+) {
+    companion object {
+        /** Default options. */
+        @JvmField
+        val DEFAULT = GblnParseOptions()
+    }
+}
+
+/**
+ * Parser implementation.
+ *
+ * Both engines accept the same input and report the same error codes.
+ */
+enum class GblnEngine {
+    /** libgbln through the FFI backend (see GblnBackend). */
+    NATIVE,
+
+    /**
+     * Pure-Kotlin parser. Needs no native library, and avoids the FFI
+     * round trip that dominates small documents.
+     */
+    JVM;
+
+    companion object {
+        /**
+         * Engine used when none is given: `-Dgbln.engine=jvm|native` or the
+         * GBLN_ENGINE environment variable, NATIVE otherwise. An unknown
+         * name is logged as a warning and also means NATIVE; throwing here
+         * would leave GblnEngine and GblnParseOptions unusable.
+         */
+        @JvmField
+        val DEFAULT: GblnEngine = requested() ?: NATIVE
+
+        private fun requested(): GblnEngine? {
+            val name = System.getProperty("gbln.engine") ?: System.getenv("GBLN_ENGINE") ?: return null
+            val engine = values().firstOrNull { it.name.equals(name, ignoreCase = true) }
+            if (engine == null) {
+                System.getLogger("dev.gbln").log(
+                    System.Logger.Level.WARNING,
+                    "Unknown GBLN engine: $name (expected native or jvm), using native"
+                )
+            }
+            return engine
+        }
+    }
+}
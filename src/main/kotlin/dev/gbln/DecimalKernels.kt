@@ -0,0 +1,167 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import java.lang.invoke.MethodHandles
+import java.lang.invoke.VarHandle
+import java.math.BigInteger
+import java.nio.ByteOrder
+
+/**
+ * Arithmetic behind GblnScalars' number parsing: SWAR digit conversion
+ * and decimal-to-binary float conversion. Syntax and range checks stay
+ * in GblnScalars.
+ */
+internal object DecimalKernels {
+
+    private val LONG_LE: VarHandle = MethodHandles.byteArrayViewVarHandle(LongArray::class.java, ByteOrder.LITTLE_ENDIAN)
+
+    private const val ZEROS = 0x3030303030303030L
+    private const val SIXES = 0x0606060606060606L
+    private const val THREES = 0x3333333333333333L
+    private const val HIGH_NIBBLES = 0x0F0F0F0F0F0F0F0FL.inv()
+
+    /**
+     * Value of the eight ASCII digits at `bytes[at]`, or -1 if any of them
+     * is not a digit. `at + 8` must not exceed the array.
+     */
+    fun eightDigits(bytes: ByteArray, at: Int): Int {
+        var v = LONG_LE.get(bytes, at) as Long
+        // A byte is a digit iff its high nibble is 3 and adding 6 keeps it 3
+        if (((v and HIGH_NIBBLES) or (((v + SIXES) and HIGH_NIBBLES) ushr 4)) != THREES) {
+            return -1
+        }
+        v -= ZEROS
+        v = v * 10 + (v ushr 8)
+        v = ((v and 0x000000FF000000FFL) * 0x000F424000000064L +
+            ((v ushr 16) and 0x000000FF000000FFL) * 0x0000271000000001L) ushr 32
+        return v.toInt()
+    }
+
+    /**
+     * IEEE 754 binary format, with the parameters of the Eisel-Lemire
+     * algorithm (as in fast_float) and of the exact fast path.
+     */
+    class Format(
+        val mantissaBits: Int,
+        val signBit: Int,
+        val minimumExponent: Int,
+        val infinitePower: Int,
+        val minRoundToEven: Int,
+        val maxRoundToEven: Int,
+        val smallestPowerOfTen: Int,
+        val largestPowerOfTen: Int,
+        val maxExactPower: Int,
+        val maxExactMantissa: Long
+    )
+
+    val DOUBLE = Format(52, 63, -1023, 0x7FF, -4, 23, -342, 308, 22, 1L shl 53)
+    val FLOAT = Format(23, 31, -127, 0xFF, -17, 10, -65, 38, 10, 1L shl 24)
+
+    private val DOUBLE_POWERS = DoubleArray(23) { "1e$it".toDouble() }
+    private val FLOAT_POWERS = FloatArray(11) { "1e$it".toFloat() }
+
+    /**
+     * Bits of the [format] value nearest to `w * 10^q` (w unsigned), with
+     * the sign set if [negative]; -1 if the caller must fall back to an
+     * exact big-number conversion.
+     */
+    fun toBits(format: Format, w: Long, q: Int, negative: Boolean): Long {
+        val sign = if (negative) 1L shl format.signBit else 0L
+
+        // Clinger: mantissa and power of ten both exact, one rounding
+        if (q >= -format.maxExactPower && q <= format.maxExactPower && w >= 0 && w <= format.maxExactMantissa) {
+            return if (format === DOUBLE) {
+                val d = w.toDouble()
+                (if (q < 0) d / DOUBLE_POWERS[-q] else d * DOUBLE_POWERS[q]).toRawBits() or sign
+            } else {
+                val f = w.toFloat()
+                (if (q < 0) f / FLOAT_POWERS[-q] else f * FLOAT_POWERS[q]).toRawBits().toLong() or sign
+            }
+        }
+
+        if (w == 0L || q < format.smallestPowerOfTen) return sign
+        if (q > format.largestPowerOfTen) return (format.infinitePower.toLong() shl format.mantissaBits) or sign
+
+        // Eisel-Lemire: w * 5^q truncated to 128 bits, refined once if the
+        // bits that decide rounding are all ones
+        val lz = java.lang.Long.numberOfLeadingZeros(w)
+        val normalised = w shl lz
+        val index = 2 * (q - PowersOfFive.SMALLEST)
+        val precisionMask = -1L ushr (format.mantissaBits + 3)
+        var high = unsignedMultiplyHigh(normalised, PowersOfFive.TABLE[index])
+        var low = normalised * PowersOfFive.TABLE[index]
+        if ((high and precisionMask) == precisionMask) {
+            val second = unsignedMultiplyHigh(normalised, PowersOfFive.TABLE[index + 1])
+            low += second
+            if (java.lang.Long.compareUnsigned(second, low) > 0) high++
+        }
+        // Possibly off by one in the last bit, and 5^q is inexact in 128 bits
+        if (low == -1L && (q < -27 || q > 55)) return -1
+
+        val upperBit = (high ushr 63).toInt()
+        val shift = upperBit + 64 - format.mantissaBits - 3
+        var mantissa = high ushr shift
+        var power2 = (((152170 + 65536) * q) shr 16) + 63 + upperBit - lz - format.minimumExponent
+
+        if (power2 <= 0) {
+            // Subnormal, or zero; rounding up may make it normal
+            if (-power2 + 1 >= 64) return sign
+            mantissa = mantissa ushr (-power2 + 1)
+            mantissa += mantissa and 1
+            mantissa = mantissa ushr 1
+            power2 = if (mantissa < (1L shl format.mantissaBits)) 0 else 1
+            return mantissa or (power2.toLong() shl format.mantissaBits) or sign
+        }
+
+        // Exactly halfway between two values: round to even
+        if ((low == 0L || low == 1L) && q >= format.minRoundToEven && q <= format.maxRoundToEven &&
+            (mantissa and 3) == 1L && (mantissa shl shift) == high
+        ) {
+            mantissa = mantissa and 1L.inv()
+        }
+        mantissa += mantissa and 1
+        mantissa = mantissa ushr 1
+        if (mantissa >= (2L shl format.mantissaBits)) {
+            mantissa = 1L shl format.mantissaBits
+            power2++
+        }
+        mantissa = mantissa and (1L shl format.mantissaBits).inv()
+        if (power2 >= format.infinitePower) {
+            return (format.infinitePower.toLong() shl format.mantissaBits) or sign
+        }
+        return mantissa or (power2.toLong() shl format.mantissaBits) or sign
+    }
+
+    private fun unsignedMultiplyHigh(a: Long, b: Long): Long =
+        Math.multiplyHigh(a, b) + ((a shr 63) and b) + ((b shr 63) and a)
+
+    /**
+     * 128-bit approximations of 5^q for q in SMALLEST..LARGEST, high word
+     * first: truncated for q >= 0, rounded up for q < 0. Computed on first
+     * use of the slow path.
+     */
+    private object PowersOfFive {
+        const val SMALLEST = -342
+        private const val LARGEST = 308
+
+        val TABLE = LongArray(2 * (LARGEST - SMALLEST + 1)).also { table ->
+            val five = BigInteger.valueOf(5)
+            for (q in SMALLEST..LARGEST) {
+                var c = if (q < 0) {
+                    val power = five.pow(-q)
+                    val z = power.bitLength()
+                    val b = if (q >= -27) z + 127 else 2 * z + 128
+                    BigInteger.ONE.shiftLeft(b).divide(power).add(BigInteger.ONE)
+                } else {
+                    five.pow(q)
+                }
+                c = if (c.bitLength() < 128) c.shiftLeft(128 - c.bitLength()) else c.shiftRight(c.bitLength() - 128)
+                val i = 2 * (q - SMALLEST)
+                table[i] = c.shiftRight(64).toLong()
+                table[i + 1] = c.toLong()
+            }
+        }
+    }
+}
@@ -0,0 +1,611 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Pointer
+
+/**
+ * Compact, immutable in-memory GBLN document.
+ *
+ * Instead of a graph of maps, lists and boxed values, the tree is stored
+ * as a tape: flat parallel arrays indexed by node number in document
+ * order (pre-order). A whole document is a handful of arrays no matter
+ * how many nodes it has:
+ *
+ * - `tags`   value type per node (GblnValueType)
+ * - `hints`  type hint the node was written with, sN bound above bit 8;
+ *   the element hint for typed arrays, -1 where there was none or the
+ *   native engine cannot report it
+ * - `words`  integer value, float bits, bool, string index or child count
+ * - `ends`   index one past the node's subtree, to skip children in O(1)
+ * - `keys`   string index of the node's key inside its parent object, or -1
+ * - `pool` / `offsets`  UTF-8 bytes of all strings; string i spans
+ *   `pool[offsets[i] until offsets[i + 1]]`. Repeated keys share one entry.
+ *
+ * Read through [root] cursors with unboxed getters; converting to Kotlin
+ * collections is an explicit [GblnCursor.toKotlin] call. The document owns
+ * no native memory and is safe to share between threads.
+ *
+ * Example:
+ * ```kotlin
+ * val doc = GblnDocument.parse(input)
+ * val port = doc.root["config"]["port"].asLong()
+ * ```
+ */
+class GblnDocument private constructor(
+    internal val tags: ByteArray,
+    internal val hints: IntArray,
+    internal val words: LongArray,
+    internal val ends: IntArray,
+    internal val keys: IntArray,
+    internal val pool: ByteArray,
+    internal val offsets: IntArray,
+    count: Int
+) {
+
+    /** Number of nodes in the document. */
+    val nodeCount: Int = count
+
+    /** Cursor at the root value. */
+    val root: GblnCursor get() = GblnCursor(this, 0)
+
+    internal fun string(index: Int, dedup: Boolean = false): String {
+        val start = offsets[index]
+        return StringValues.decode(pool, start, offsets[index + 1] - start, dedup)
+    }
+
+    internal fun key(index: Int): String {
+        val start = offsets[index]
+        return KeyInterner.intern(pool, start, offsets[index + 1] - start)
+    }
+
+    internal fun stringEquals(index: Int, utf8: ByteArray): Boolean {
+        val start = offsets[index]
+        val len = offsets[index + 1] - start
+        return len == utf8.size && java.util.Arrays.equals(pool, start, start + len, utf8, 0, len)
+    }
+
+    companion object {
+        /**
+         * Copy a parsed value into a document. The value can be closed
+         * afterwards.
+         */
+        fun from(value: ManagedGblnValue): GblnDocument {
+            val builder = TapeBuilder()
+            val ptr = value.ptr
+            try {
+                builder.appendWalk(ptr, -1)
+            } finally {
+                java.lang.ref.Reference.reachabilityFence(value)
+            }
+            return builder.build()
+        }
+
+        /**
+         * Parse GBLN into a document. With the native engine the native
+         * tree is freed right away; the JVM engine builds the tape directly.
+         *
+         * @throws ParseError if parsing fails
+         */
+        fun parse(gblnString: String, engine: GblnEngine = GblnEngine.DEFAULT): GblnDocument =
+            if (engine == GblnEngine.JVM) {
+                val bytes = gblnString.toByteArray(Charsets.UTF_8)
+                parse(bytes, 0, bytes.size, engine)
+            } else {
+                parseRaw(gblnString).use { from(it) }
+            }
+
+        /**
+         * Parse UTF-8 bytes into a document.
+         *
+         * @throws ParseError if parsing fails
+         */
+        fun parse(
+            bytes: ByteArray,
+            offset: Int = 0,
+            length: Int = bytes.size - offset,
+            engine: GblnEngine = GblnEngine.DEFAULT
+        ): GblnDocument {
+            if (engine == GblnEngine.JVM) {
+                checkBounds(bytes, offset, length)
+                return try {
+                    JvmParser.parse(bytes, offset, length)
+                } catch (e: GblnSyntaxException) {
+                    throw e.toParseError()
+                }
+            }
+            return parseRaw(bytes, offset, length).use { from(it) }
+        }
+
+        internal fun of(
+            tags: ByteArray,
+            hints: IntArray,
+            words: LongArray,
+            ends: IntArray,
+            keys: IntArray,
+            pool: ByteArray,
+            offsets: IntArray,
+            count: Int = tags.size
+        ) = GblnDocument(tags, hints, words, ends, keys, pool, offsets, count)
+    }
+}
+
+/**
+ * Position of one node in a GblnDocument.
+ *
+ * Cursors are cheap, immutable and never touch native memory.
+ */
+class GblnCursor internal constructor(private val doc: GblnDocument, private val index: Int) {
+
+    /** Value type discriminant (see GblnValueType). */
+    val type: Int get() = doc.tags[index].toInt()
+
+    val isNull: Boolean get() = type == GblnValueType.NULL
+    val isObject: Boolean get() = type == GblnValueType.OBJECT
+    val isArray: Boolean get() = type == GblnValueType.ARRAY
+
+    /**
+     * Element type of a typed array (`tags<s16>[...]`), also when it is
+     * empty; -1 for untyped arrays, other nodes, and documents parsed by
+     * the native engine.
+     */
+    val elementType: Int
+        get() = if (type == GblnValueType.ARRAY && doc.hints[index] >= 0) doc.hints[index] and 0xFF else -1
+
+    /**
+     * Maximum length N of an `sN` string, or of the elements of an `sN`
+     * typed array; -1 if there is none or it was not recorded (native
+     * engine).
+     */
+    val maxLength: Int
+        get() {
+            val hint = doc.hints[index]
+            return if (hint >= 0 && (hint and 0xFF) == GblnValueType.STRING) hint ushr 8 else -1
+        }
+
+    /** Key of this node in its parent object, or null. */
+    val key: String?
+        get() {
+            val k = doc.keys[index]
+            return if (k < 0) null else doc.key(k)
+        }
+
+    /** Number of fields (object) or elements (array); 0 for scalars. */
+    val size: Int
+        get() = if (type == GblnValueType.OBJECT || type == GblnValueType.ARRAY) doc.words[index].toInt() else 0
+
+    /** Object keys in document order. */
+    val keys: List<String>
+        get() {
+            expect(GblnValueType.OBJECT)
+            return children().map { doc.key(doc.keys[it]) }
+        }
+
+    /**
+     * Object field by key.
+     *
+     * @throws ValidationError if this node is not an object or has no such key
+     */
+    operator fun get(key: String): GblnCursor = getOrNull(key) ?: throw ValidationError("No such key: $key")
+
+    /**
+     * Object field by key, or null if absent.
+     *
+     * @throws ValidationError if this node is not an object
+     */
+    fun getOrNull(key: String): GblnCursor? {
+        expect(GblnValueType.OBJECT)
+        val utf8 = key.toByteArray(Charsets.UTF_8)
+        var child = index + 1
+        val end = doc.ends[index]
+        while (child < end) {
+            if (doc.stringEquals(doc.keys[child], utf8)) {
+                return GblnCursor(doc, child)
+            }
+            child = doc.ends[child]
+        }
+        return null
+    }
+
+    /**
+     * Array element by index. O(1) when all elements are scalars,
+     * otherwise skips over preceding subtrees.
+     *
+     * @throws ValidationError if this node is not an array
+     * @throws IndexOutOfBoundsException if index is outside 0 until size
+     */
+    operator fun get(i: Int): GblnCursor {
+        expect(GblnValueType.ARRAY)
+        val count = size
+        if (i < 0 || i >= count) {
+            throw IndexOutOfBoundsException("Index $i, size $count")
+        }
+        if (doc.ends[index] - index - 1 == count) {
+            return GblnCursor(doc, index + 1 + i)
+        }
+
+        var child = index + 1
+        repeat(i) { child = doc.ends[child] }
+        return GblnCursor(doc, child)
+    }
+
+    /** Child cursors (object field values or array elements) in order. */
+    fun children(): List<GblnCursor> = childIndices().map { GblnCursor(doc, it) }
+
+    /**
+     * Integer value of any width as Long (u64 keeps its bit pattern).
+     *
+     * @throws ValidationError if this node is not an integer
+     */
+    fun asLong(): Long {
+        if (type !in GblnValueType.I8..GblnValueType.U64) {
+            throw ValidationError("Expected integer value, found ${GblnValueType.nameOf(type)}")
+        }
+        return doc.words[index]
+    }
+
+    /**
+     * Float value of either width as Double.
+     *
+     * @throws ValidationError if this node is not a float
+     */
+    fun asDouble(): Double = when (type) {
+        GblnValueType.F32 -> Float.fromBits(doc.words[index].toInt()).toDouble()
+        GblnValueType.F64 -> Double.fromBits(doc.words[index])
+        else -> throw ValidationError("Expected float value, found ${GblnValueType.nameOf(type)}")
+    }
+
+    /**
+     * Bool value.
+     *
+     * @throws ValidationError if this node is not a bool
+     */
+    fun asBoolean(): Boolean {
+        expect(GblnValueType.BOOL)
+        return doc.words[index] != 0L
+    }
+
+    /**
+     * String value.
+     *
+     * @throws ValidationError if this node is not a string
+     */
+    fun asString(): String {
+        expect(GblnValueType.STRING)
+        return doc.string(doc.words[index].toInt())
+    }
+
+    /**
+     * Convert this subtree to Kotlin values, with the same shapes parse()
+     * produces for the given options.
+     */
+    fun toKotlin(options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? =
+        toKotlin(index, options, if (options.compactObjects) ShapeTable() else null, -1, null)
+
+    /**
+     * toKotlin() sharing [shapes] with other conversions, so objects
+     * converted separately still share their shapes.
+     */
+    internal fun toKotlin(options: GblnParseOptions, shapes: ShapeTable?): Any? =
+        toKotlin(index, options, shapes, -1, null)
+
+    /**
+     * toKotlin() with [replacement] in place of the value at tape node
+     * [node] (ParallelParser's placeholder).
+     */
+    internal fun toKotlinReplacing(node: Int, replacement: Any?, options: GblnParseOptions): Any? =
+        toKotlin(index, options, if (options.compactObjects) ShapeTable() else null, node, replacement)
+
+    override fun toString(): String = "GblnCursor(${GblnValueType.nameOf(type)})"
+
+    private fun toKotlin(
+        node: Int,
+        options: GblnParseOptions,
+        shapes: ShapeTable?,
+        replaced: Int,
+        replacement: Any?
+    ): Any? {
+        if (node == replaced) {
+            return replacement
+        }
+        val word = doc.words[node]
+        return when (val tag = doc.tags[node].toInt()) {
+            GblnValueType.NULL -> null
+            GblnValueType.BOOL -> word != 0L
+            GblnValueType.I8, GblnValueType.I16, GblnValueType.I32, GblnValueType.U8, GblnValueType.U16 -> word.toInt()
+            GblnValueType.I64, GblnValueType.U32, GblnValueType.U64 -> word
+            GblnValueType.F32 -> Float.fromBits(word.toInt())
+            GblnValueType.F64 -> Double.fromBits(word)
+            GblnValueType.STRING -> doc.string(word.toInt(), options.dedupStrings)
+            GblnValueType.ARRAY -> {
+                val count = word.toInt()
+                val primitive = if (options.primitiveArrays) primitiveArray(node, count) else null
+                primitive ?: ArrayList<Any?>(count).also { list ->
+                    var child = node + 1
+                    repeat(count) {
+                        list.add(toKotlin(child, options, shapes, replaced, replacement))
+                        child = doc.ends[child]
+                    }
+                }
+            }
+            GblnValueType.OBJECT -> {
+                val count = word.toInt()
+                if (shapes != null) {
+                    var transition = shapes.root
+                    var child = node + 1
+                    val values = arrayOfNulls<Any?>(count)
+                    for (i in 0 until count) {
+                        transition = transition.next(doc.key(doc.keys[child]))
+                        values[i] = toKotlin(child, options, shapes, replaced, replacement)
+                        child = doc.ends[child]
+                    }
+                    shapes.build(transition, values)
+                } else {
+                    LinkedHashMap<String, Any?>(mapCapacity(count)).also { map ->
+                        var child = node + 1
+                        repeat(count) {
+                            map[doc.key(doc.keys[child])] = toKotlin(child, options, shapes, replaced, replacement)
+                            child = doc.ends[child]
+                        }
+                    }
+                }
+            }
+            else -> throw ValidationError("Unknown value type: $tag")
+        }
+    }
+
+    private fun primitiveArray(node: Int, count: Int): Any? {
+        // Homogeneous scalar arrays are contiguous leaves on the tape
+        if (count == 0 || doc.ends[node] - node - 1 != count) {
+            return null
+        }
+        val first = node + 1
+        val tag = doc.tags[first].toInt()
+        if (!isPrimitiveArrayType(tag) || (1 until count).any { doc.tags[first + it].toInt() != tag }) {
+            return null
+        }
+
+        val w = doc.words
+        return when (tag) {
+            GblnValueType.I8 -> ByteArray(count) { w[first + it].toByte() }
+            GblnValueType.I16, GblnValueType.U8 -> ShortArray(count) { w[first + it].toShort() }
+            GblnValueType.I32, GblnValueType.U16 -> IntArray(count) { w[first + it].toInt() }
+            GblnValueType.I64, GblnValueType.U32, GblnValueType.U64 -> LongArray(count) { w[first + it] }
+            GblnValueType.F32 -> FloatArray(count) { Float.fromBits(w[first + it].toInt()) }
+            GblnValueType.F64 -> DoubleArray(count) { Double.fromBits(w[first + it]) }
+            else -> BooleanArray(count) { w[first + it] != 0L }
+        }
+    }
+
+    private fun childIndices(): List<Int> {
+        val result = ArrayList<Int>(size)
+        var child = index + 1
+        val end = doc.ends[index]
+        while (child < end) {
+            result.add(child)
+            child = doc.ends[child]
+        }
+        return result
+    }
+
+    private fun expect(expected: Int) {
+        if (type != expected) {
+            throw ValidationError("Expected ${GblnValueType.nameOf(expected)}, found ${GblnValueType.nameOf(type)}")
+        }
+    }
+}
+
+/**
+ * Append-only builder for GblnDocument tapes.
+ */
+internal class TapeBuilder {
+
+    private var tags = ByteArray(64)
+    private var hints = IntArray(64)
+    private var words = LongArray(64)
+    private var ends = IntArray(64)
+    private var keys = IntArray(64)
+    private var count = 0
+
+    private var pool = ByteArray(256)
+    private var poolSize = 0
+    private var offsets = IntArray(32)
+    private var stringCount = 0
+
+    // Open-addressing table of key string indices (+1; 0 = empty), so
+    // repeated object keys are stored once
+    private var keyTable = IntArray(64)
+    private var keyTableSize = 0
+
+    /**
+     * Add a node and return its index. Containers must be closed with [end].
+     * [hint] is the type hint it was written with (see GblnDocument), or -1.
+     */
+    fun node(tag: Int, word: Long, key: Int, hint: Int = -1): Int {
+        if (count == tags.size) {
+            val newSize = count * 2
+            tags = tags.copyOf(newSize)
+            hints = hints.copyOf(newSize)
+            words = words.copyOf(newSize)
+            ends = ends.copyOf(newSize)
+            keys = keys.copyOf(newSize)
+        }
+        val index = count++
+        tags[index] = tag.toByte()
+        hints[index] = hint
+        words[index] = word
+        keys[index] = key
+        ends[index] = count
+        return index
+    }
+
+    /** Discard all nodes and strings, keeping the allocated storage. */
+    fun reset() {
+        count = 0
+        poolSize = 0
+        stringCount = 0
+        keyTable.fill(0)
+        keyTableSize = 0
+    }
+
+    /** Close the container at [index]: its subtree ends here. */
+    fun end(index: Int) {
+        ends[index] = count
+    }
+
+    /** Close the container at [index], recording its child count. */
+    fun end(index: Int, children: Int) {
+        words[index] = children.toLong()
+        ends[index] = count
+    }
+
+    /** Decode the key or string at [index] (for error messages). */
+    fun keyString(index: Int): String =
+        String(pool, offsets[index], offsets[index + 1] - offsets[index], Charsets.UTF_8)
+
+    /** Add a string value and return its index. */
+    fun string(bytes: ByteArray, offset: Int, length: Int): Int {
+        ensurePool(length)
+        System.arraycopy(bytes, offset, pool, poolSize, length)
+        return commitString(length)
+    }
+
+    /** Add an object key, sharing storage with an identical earlier key. */
+    fun key(bytes: ByteArray, offset: Int, length: Int): Int {
+        var hash = 1
+        for (i in offset until offset + length) {
+            hash = 31 * hash + bytes[i]
+        }
+
+        val mask = keyTable.size - 1
+        var slot = (hash xor (hash ushr 16)) and mask
+        while (true) {
+            val entry = keyTable[slot]
+            if (entry == 0) break
+            val start = offsets[entry - 1]
+            val len = offsets[entry] - start
+            if (len == length && java.util.Arrays.equals(pool, start, start + len, bytes, offset, offset + length)) {
+                return entry - 1
+            }
+            slot = (slot + 1) and mask
+        }
+
+        val index = string(bytes, offset, length)
+        keyTable[slot] = index + 1
+        if (++keyTableSize * 2 > keyTable.size) {
+            rehashKeys()
+        }
+        return index
+    }
+
+    fun key(key: String): Int {
+        val bytes = key.toByteArray(Charsets.UTF_8)
+        return key(bytes, 0, bytes.size)
+    }
+
+    /**
+     * Append a native value tree node by node.
+     */
+    fun appendWalk(value: Pointer, key: Int) {
+        when (val type = lib.gbln_value_type(value)) {
+            GblnValueType.NULL -> node(type, 0, key)
+            GblnValueType.BOOL -> node(type, if (readBoolean(value, type)) 1 else 0, key)
+            GblnValueType.F32 -> node(type, readDouble(value, type).toFloat().toRawBits().toLong(), key)
+            GblnValueType.F64 -> node(type, readDouble(value, type).toRawBits(), key)
+            GblnValueType.STRING -> {
+                val bytes = readString(value, type).toByteArray(Charsets.UTF_8)
+                node(type, string(bytes, 0, bytes.size).toLong(), key)
+            }
+            GblnValueType.ARRAY -> {
+                val len = lib.gbln_array_len(value)
+                val index = node(type, 0, key)
+                var added = 0L
+                for (i in 0 until len) {
+                    val elem = lib.gbln_array_get(value, i)
+                    if (elem != null && Pointer.nativeValue(elem) != 0L) {
+                        appendWalk(elem, -1)
+                        added++
+                    }
+                }
+                words[index] = added
+                end(index)
+            }
+            GblnValueType.OBJECT -> {
+                val index = node(type, 0, key)
+                var added = 0L
+                for (name in readObjectKeys(value)) {
+                    val field = lib.gbln_object_get(value, name)
+                    if (field != null && Pointer.nativeValue(field) != 0L) {
+                        appendWalk(field, key(name))
+                        added++
+                    }
+                }
+                words[index] = added
+                end(index)
+            }
+            in GblnValueType.I8..GblnValueType.U64 -> node(type, readLong(value, type), key)
+            else -> throw ValidationError("Unknown value type: $type")
+        }
+    }
+
+    fun build(): GblnDocument {
+        offsets[stringCount] = poolSize
+        return GblnDocument.of(
+            tags.copyOf(count),
+            hints.copyOf(count),
+            words.copyOf(count),
+            ends.copyOf(count),
+            keys.copyOf(count),
+            pool.copyOf(poolSize),
+            offsets.copyOf(stringCount + 1)
+        )
+    }
+
+    /**
+     * Document over this builder's own arrays, without copying them. It is
+     * only valid until the next [reset], so use it for a tape that is
+     * converted and dropped straight away.
+     */
+    fun view(): GblnDocument {
+        offsets[stringCount] = poolSize
+        return GblnDocument.of(tags, hints, words, ends, keys, pool, offsets, count)
+    }
+
+    private fun ensurePool(length: Int) {
+        if (poolSize + length > pool.size) {
+            pool = pool.copyOf(maxOf(poolSize + length, pool.size * 2))
+        }
+    }
+
+    private fun commitString(length: Int): Int {
+        // offsets always has room for one more entry: the end marker
+        if (stringCount + 2 > offsets.size) {
+            offsets = offsets.copyOf(offsets.size * 2)
+        }
+        val index = stringCount++
+        offsets[index] = poolSize
+        poolSize += length
+        offsets[stringCount] = poolSize
+        return index
+    }
+
+    private fun rehashKeys() {
+        val old = keyTable
+        keyTable = IntArray(old.size * 2)
+        val mask = keyTable.size - 1
+        for (entry in old) {
+            if (entry == 0) continue
+            val start = offsets[entry - 1]
+            var hash = 1
+            for (i in start until offsets[entry]) {
+                hash = 31 * hash + pool[i]
+            }
+            var slot = (hash xor (hash ushr 16)) and mask
+            while (keyTable[slot] != 0) {
+                slot = (slot + 1) and mask
+            }
+            keyTable[slot] = entry
+        }
+    }
+}
@@ -3,13 +3,29 @@
 
 package dev.gbln
 
+/**
+ * Error reporting settings.
+ */
+object GblnErrors {
+    /**
+     * Fast-failure mode. When true, GBLN exceptions are created without
+     * capturing a stack trace, which makes rejecting bad input several
+     * times cheaper; the message and error code are unaffected. Read once
+     * from -Dgbln.fastFail=true at startup and can be changed at runtime.
+     */
+    @JvmStatic
+    @Volatile
+    var fastFail: Boolean = System.getProperty("gbln.fastFail") == "true"
+}
+
 /**
  * Base exception for all GBLN errors.
  *
  * All GBLN-specific exceptions inherit from this class,
  * allowing for easy catching of all GBLN-related errors.
+ * In fast-failure mode (GblnErrors.fastFail) they carry no stack trace.
  */
-sealed class GblnError(message: String) : Exception(message)
+sealed class GblnError(message: String) : Exception(message, null, true, !GblnErrors.fastFail)
 
 /**
  * Raised when parsing fails.
@@ -19,8 +35,13 @@ sealed class GblnError(message: String) : Exception(message)
  * - Unexpected characters
  * - Unterminated strings
  * - Invalid type hints
+ *
+ * @property code Error code reported by the parser (see GblnErrorCode)
  */
-class ParseError(message: String) : GblnError(message)
+class ParseError(
+    message: String,
+    val code: Int = GblnErrorCode.ERROR_INVALID_SYNTAX
+) : GblnError(message)
 
 /**
  * Raised when validation fails.
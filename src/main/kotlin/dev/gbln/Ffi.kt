@@ -64,6 +64,16 @@ object GblnValueType {
     const val NULL = 12
     const val OBJECT = 13
     const val ARRAY = 14
+
+    private val NAMES = arrayOf(
+        "i8", "i16", "i32", "i64", "u8", "u16", "u32", "u64",
+        "f32", "f64", "bool", "string", "null", "object", "array"
+    )
+
+    /**
+     * Type name for error messages, e.g. "u32" or "object".
+     */
+    fun nameOf(valueType: Int): String = NAMES.getOrNull(valueType) ?: "unknown($valueType)"
 }
 
 // Opaque pointer type
@@ -74,9 +84,11 @@ class GblnValue : PointerType()
  *
  * Search order (same as Python):
  * 1. GBLN_LIBRARY_PATH environment variable
- * 2. Alongside package (bundled in JAR)
+ * 2. Alongside package (bundled in JAR, via the persistent LibraryCache)
  * 3. core/ffi/libs/{platform}/ (pre-built committed libraries)
  * 4. System library paths
+ *
+ * Records where the library came from in librarySource.
  */
 private fun findLibrary(): Path? {
     // Determine platform-specific library directory and name
@@ -118,28 +130,38 @@ private fun findLibrary(): Path? {
     System.getenv("GBLN_LIBRARY_PATH")?.let { envPath ->
         val libPath = Paths.get(envPath)
         if (libPath.toFile().exists()) {
+            librarySource = GblnLibrarySource.ENVIRONMENT
             return libPath
         }
     }
 
     // 2. Try alongside package (bundled in JAR)
-    // Extract from JAR resources if needed
+    // A cache hit returns here, before any directory probing
+    val resourcePath = "/native/$libDir/$libName"
     try {
-        val resourcePath = "/native/$libDir/$libName"
-        val resource = object {}.javaClass.getResourceAsStream(resourcePath)
-        if (resource != null) {
-            // Extract to temp file
-            val tempFile = File.createTempFile("libgbln", libName.substringAfterLast('.'))
-            tempFile.deleteOnExit()
-            resource.use { input ->
-                tempFile.outputStream().use { output ->
-                    input.copyTo(output)
+        LibraryCache.extract(resourcePath, libName)?.let { entry ->
+            librarySource = if (entry.hit) GblnLibrarySource.CACHE_HIT else GblnLibrarySource.CACHE_EXTRACTED
+            return entry.path
+        }
+    } catch (cacheFailure: Exception) {
+        // Cache directory unusable (e.g. read-only home): per-process copy
+        try {
+            val resource = object {}.javaClass.getResourceAsStream(resourcePath)
+            if (resource != null) {
+                // Extract to temp file
+                val tempFile = File.createTempFile("libgbln", libName.substringAfterLast('.'))
+                tempFile.deleteOnExit()
+                resource.use { input ->
+                    tempFile.outputStream().use { output ->
+                        input.copyTo(output)
+                    }
                 }
+                librarySource = GblnLibrarySource.TEMP_FILE
+                return tempFile.toPath()
             }
-            return tempFile.toPath()
+        } catch (e: Exception) {
+            // Resource not found in JAR, continue
         }
-    } catch (e: Exception) {
-        // Resource not found in JAR, continue
     }
 
     // 3. Try core/ffi/libs/{platform}/ (pre-built committed libraries)
@@ -150,6 +172,7 @@ private fun findLibrary(): Path? {
         while (attempts < 10) {
             val libsPath = currentDir.resolve("core/ffi/libs/$libDir/$libName")
             if (libsPath.exists()) {
+                librarySource = GblnLibrarySource.PROJECT
                 return libsPath.toPath()
             }
             val parent = currentDir.parentFile ?: break
@@ -165,6 +188,7 @@ private fun findLibrary(): Path? {
             while (attempts < 10) {
                 val libsPath = searchDir.resolve("../../core/ffi/libs/$libDir/$libName")
                 if (libsPath.exists()) {
+                    librarySource = GblnLibrarySource.PROJECT
                     return libsPath.canonicalFile.toPath()
                 }
                 val parent = searchDir.parentFile ?: break
@@ -181,10 +205,218 @@ private fun findLibrary(): Path? {
 }
 
 /**
- * Load libgbln shared library using JNA.
+ * Resolved libgbln location, or null to fall back to system paths.
+ */
+private val libraryPath: Path? by lazy {
+    val start = System.nanoTime()
+    findLibrary().also { locateNanos = System.nanoTime() - start }
+}
+
+private var librarySource = GblnLibrarySource.SYSTEM
+private var locateNanos = 0L
+private var bindNanos = 0L
+
+/**
+ * Where libgbln was loaded from.
+ */
+enum class GblnLibrarySource {
+    /** GBLN_LIBRARY_PATH. */
+    ENVIRONMENT,
+
+    /** Bundled library, already in the persistent cache. */
+    CACHE_HIT,
+
+    /** Bundled library, extracted to the persistent cache by this process. */
+    CACHE_EXTRACTED,
+
+    /** Bundled library, copied to a temp file because the cache was unusable. */
+    TEMP_FILE,
+
+    /** core/ffi/libs in an enclosing source checkout. */
+    PROJECT,
+
+    /** System library search path. */
+    SYSTEM
+}
+
+/**
+ * How long it took to find and bind libgbln.
+ *
+ * @property source Where the library came from
+ * @property libraryPath Resolved path, or null for a system-wide install
+ * @property locateNanos Time spent locating (and extracting) the library
+ * @property bindNanos Time spent loading it and binding its symbols
+ */
+data class GblnStartupMetrics(
+    val source: GblnLibrarySource,
+    val libraryPath: Path?,
+    val locateNanos: Long,
+    val bindNanos: Long
+)
+
+/**
+ * Startup metrics of the loaded library. Loads it if needed.
+ */
+val gblnStartupMetrics: GblnStartupMetrics
+    get() {
+        lib
+        return GblnStartupMetrics(librarySource, libraryPath, locateNanos, bindNanos)
+    }
+
+/**
+ * Name passed to JNA when loading libgbln: the resolved path, or the bare
+ * library name for a system-wide install.
+ */
+internal val libraryName: String
+    get() = libraryPath?.toString() ?: "gbln"
+
+/**
+ * FFI binding strategy for libgbln.
+ *
+ * Chosen once at load time from the `gbln.backend` system property or the
+ * GBLN_BACKEND environment variable ("panama", "direct" or "jna"). By
+ * default PANAMA is used on JDK 22+ (from the multi-release JAR) when
+ * native access is enabled for this module (`--enable-native-access`),
+ * so it never triggers the JDK's restricted-method warning; DIRECT
+ * otherwise, falling back to JNA if direct registration fails.
+ */
+enum class GblnBackend {
+    /** java.lang.foreign downcall handles (JDK 22+, multi-release JAR only). */
+    PANAMA,
+
+    /** Native.register with external functions (no per-call reflection). */
+    DIRECT,
+
+    /** Native.load interface proxy. */
+    JNA;
+
+    companion object {
+        internal fun requested(): GblnBackend? {
+            val name = System.getProperty("gbln.backend") ?: System.getenv("GBLN_BACKEND") ?: return null
+            return values().firstOrNull { it.name.equals(name, ignoreCase = true) }
+                ?: throw IllegalArgumentException("Unknown GBLN backend: $name (expected panama, direct or jna)")
+        }
+    }
+}
+
+/**
+ * Backend actually in use once the library has loaded.
+ */
+val gblnBackend: GblnBackend
+    get() = when (lib) {
+        is DirectGblnLibrary -> GblnBackend.DIRECT
+        is NativeStringReader -> GblnBackend.PANAMA
+        else -> GblnBackend.JNA
+    }
+
+/**
+ * Backends that read NUL-terminated UTF-8 natively instead of through
+ * JNA's Pointer.getString copies.
+ */
+internal interface NativeStringReader {
+    fun readUtf8(address: Long): String
+}
+
+/**
+ * Read a NUL-terminated UTF-8 string owned by libgbln.
+ */
+internal fun readUtf8(ptr: Pointer): String {
+    val reader = lib as? NativeStringReader
+    return reader?.readUtf8(Pointer.nativeValue(ptr)) ?: ptr.getString(0, "UTF-8")
+}
+
+/**
+ * Take the message of the last libgbln error on this thread, or null if
+ * none was set.
+ */
+internal fun lastErrorMessage(): String? {
+    val msgPtr = lib.gbln_last_error_message()
+    if (msgPtr == null || Pointer.nativeValue(msgPtr) == 0L) {
+        return null
+    }
+    return try {
+        readUtf8(msgPtr)
+    } finally {
+        lib.gbln_string_free(msgPtr)
+    }
+}
+
+/**
+ * Load libgbln with the requested backend.
  */
 private fun loadLibrary(): GblnLibrary {
-    val libPath = findLibrary()
+    val requested = GblnBackend.requested()
+    if (requested == GblnBackend.JNA) {
+        return loadProxyLibrary()
+    }
+
+    if (requested == GblnBackend.PANAMA || (requested == null && nativeAccessEnabled())) {
+        loadPanamaLibrary()?.let { return it }
+        if (requested == GblnBackend.PANAMA) {
+            throw IoError("Panama backend requires JDK 22+ and the multi-release JAR")
+        }
+    }
+
+    val failure: Throwable = try {
+        return loadDirectLibrary()
+    } catch (e: UnsatisfiedLinkError) {
+        e
+    } catch (e: IllegalArgumentException) {
+        e
+    }
+
+    if (requested == GblnBackend.DIRECT) {
+        throw IoError("Failed to bind GBLN library directly from $libraryName: ${failure.message}")
+    }
+    return loadProxyLibrary()
+}
+
+/**
+ * Whether this module may call restricted java.lang.foreign methods
+ * without a warning. Module.isNativeAccessEnabled is JDK 22+ API, so it
+ * is looked up reflectively.
+ */
+private fun nativeAccessEnabled(): Boolean = try {
+    Module::class.java.getMethod("isNativeAccessEnabled").invoke(GblnLibrary::class.java.module) as Boolean
+} catch (e: NoSuchMethodException) {
+    false
+}
+
+/**
+ * Instantiate the java.lang.foreign binding from META-INF/versions/22.
+ *
+ * Returns null on older JDKs or when the class is not on the class path
+ * (e.g. running from the unpacked build directory).
+ */
+private fun loadPanamaLibrary(): GblnLibrary? {
+    if (Runtime.version().feature() < 22) {
+        return null
+    }
+
+    return try {
+        val cls = Class.forName("dev.gbln.PanamaGblnLibrary", true, GblnLibrary::class.java.classLoader)
+        cls.getDeclaredConstructor().newInstance() as GblnLibrary
+    } catch (e: ClassNotFoundException) {
+        null
+    } catch (e: LinkageError) {
+        // Symbol lookup failed in the static initialiser
+        null
+    }
+}
+
+/**
+ * Register DirectGblnLibrary's external functions against libgbln.
+ */
+private fun loadDirectLibrary(): GblnLibrary {
+    Native.register(DirectGblnLibrary::class.java, NativeLibrary.getInstance(libraryName))
+    return DirectGblnLibrary()
+}
+
+/**
+ * Load libgbln shared library using JNA.
+ */
+private fun loadProxyLibrary(): GblnLibrary {
+    val libPath = libraryPath
 
     return if (libPath != null) {
         try {
@@ -213,6 +445,7 @@ private fun loadLibrary(): GblnLibrary {
 interface GblnLibrary : Library {
     // Parser
     fun gbln_parse(input: String, outValue: com.sun.jna.ptr.PointerByReference): Int
+    fun gbln_parse(input: Pointer, outValue: com.sun.jna.ptr.PointerByReference): Int
     fun gbln_parse_file(path: String, outValue: com.sun.jna.ptr.PointerByReference): Int
 
     // Serialiser
@@ -242,6 +475,7 @@ interface GblnLibrary : Library {
 
     // Object operations
     fun gbln_object_get(obj: Pointer, key: String): Pointer
+    fun gbln_object_get(obj: Pointer, key: Pointer): Pointer
     fun gbln_object_len(obj: Pointer): Long
     fun gbln_object_keys(obj: Pointer, outCount: com.sun.jna.ptr.LongByReference): Pointer
 
@@ -263,7 +497,74 @@ interface GblnLibrary : Library {
     fun gbln_string_free(str: Pointer)
 }
 
+/**
+ * Direct-mapped libgbln binding.
+ *
+ * JNA registers each external function straight against its native symbol,
+ * so calls skip the proxy's method lookup, argument array and boxing.
+ * Signatures mirror GblnLibrary one to one.
+ */
+internal class DirectGblnLibrary : GblnLibrary {
+    // Parser
+    external override fun gbln_parse(input: String, outValue: com.sun.jna.ptr.PointerByReference): Int
+    external override fun gbln_parse(input: Pointer, outValue: com.sun.jna.ptr.PointerByReference): Int
+    external override fun gbln_parse_file(path: String, outValue: com.sun.jna.ptr.PointerByReference): Int
+
+    // Serialiser
+    external override fun gbln_to_string(value: Pointer): Pointer
+    external override fun gbln_to_string_pretty(value: Pointer): Pointer
+    external override fun gbln_write_file(path: String, value: Pointer): Int
+
+    // Memory
+    external override fun gbln_value_free(value: Pointer)
+
+    // Type query
+    external override fun gbln_value_type(value: Pointer): Int
+
+    // Value getters (with ok flag)
+    external override fun gbln_value_as_i8(value: Pointer, ok: ByteArray): Byte
+    external override fun gbln_value_as_i16(value: Pointer, ok: ByteArray): Short
+    external override fun gbln_value_as_i32(value: Pointer, ok: ByteArray): Int
+    external override fun gbln_value_as_i64(value: Pointer, ok: ByteArray): Long
+    external override fun gbln_value_as_u8(value: Pointer, ok: ByteArray): Short
+    external override fun gbln_value_as_u16(value: Pointer, ok: ByteArray): Int
+    external override fun gbln_value_as_u32(value: Pointer, ok: ByteArray): Long
+    external override fun gbln_value_as_u64(value: Pointer, ok: ByteArray): Long
+    external override fun gbln_value_as_f32(value: Pointer, ok: ByteArray): Float
+    external override fun gbln_value_as_f64(value: Pointer, ok: ByteArray): Double
+    external override fun gbln_value_as_bool(value: Pointer, ok: ByteArray): Byte
+    external override fun gbln_value_as_string(value: Pointer, ok: ByteArray): Pointer
+
+    // Object operations
+    external override fun gbln_object_get(obj: Pointer, key: String): Pointer
+    external override fun gbln_object_get(obj: Pointer, key: Pointer): Pointer
+    external override fun gbln_object_len(obj: Pointer): Long
+    external override fun gbln_object_keys(obj: Pointer, outCount: com.sun.jna.ptr.LongByReference): Pointer
+
+    // Array operations
+    external override fun gbln_array_get(array: Pointer, index: Long): Pointer
+    external override fun gbln_array_len(array: Pointer): Long
+
+    // I/O operations
+    external override fun gbln_read_io(path: String, outValue: com.sun.jna.ptr.PointerByReference): Int
+    external override fun gbln_write_io(value: Pointer, path: String, config: Pointer): Int
+
+    // Configuration
+    external override fun gbln_config_new(miniMode: Boolean, compress: Boolean, compressionLevel: Int, indent: Int, stripComments: Boolean): Pointer
+    external override fun gbln_config_new_io(): Pointer
+    external override fun gbln_config_free(config: Pointer)
+
+    // Error handling
+    external override fun gbln_last_error_message(): Pointer
+    external override fun gbln_string_free(str: Pointer)
+}
+
 /**
  * Global library instance (lazy-loaded).
  */
-internal val lib: GblnLibrary by lazy { loadLibrary() }
+internal val lib: GblnLibrary by lazy {
+    // Resolve the path first so locating and binding are timed apart
+    libraryPath
+    val start = System.nanoTime()
+    loadLibrary().also { bindNanos = System.nanoTime() - start }
+}
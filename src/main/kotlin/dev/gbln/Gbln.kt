@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.NativeLibrary
+import com.sun.jna.Pointer
+
+/**
+ * Process-level entry points.
+ */
+object Gbln {
+
+    /**
+     * Document covering every value type, hint width and container shape,
+     * so warmup() runs every conversion branch.
+     */
+    private const val WARMUP_INPUT =
+        "warmup{" +
+            "i8<i8>(-128)i16<i16>(-32768)i32<i32>(-2147483648)i64<i64>(-9223372036854775808)" +
+            "u8<u8>(255)u16<u16>(65535)u32<u32>(4294967295)u64<u64>(18446744073709551615)" +
+            "f32<f32>(3.5)f64<f64>(2.718281828459045)s<s16>(warmup)t<b>(t)f<b>(f)n<n>()" +
+            "bytes<i8>[1 2 3]shorts<u8>[1 2 3]ints<i32>[1 2 3]longs<u64>[1 2 3]" +
+            "floats<f32>[1.5 2.5]doubles<f64>[1.5 2.5]flags<b>[t f]tags<s8>[a b]" +
+            "records[{id<u32>(1)name<s8>(a)}{id<u32>(2)name<s8>(b)}]" +
+            "nested{inner{deep<i32>(1)}}" +
+            "}"
+
+    /**
+     * Load libgbln and run every conversion path once, so the first real
+     * parse() does not pay for library extraction, symbol binding and
+     * class loading, and the hot paths are already compiled.
+     *
+     * Safe to call more than once and from several threads; later calls
+     * only repeat the exercise phase.
+     *
+     * @param iterations How often to run the parse and convert phases;
+     *   a few hundred gets the conversion code through the JIT's first tier
+     * @return Time spent in each phase
+     * @throws IoError if libgbln cannot be loaded
+     */
+    fun warmup(iterations: Int = 200): GblnWarmupReport {
+        require(iterations >= 1) { "iterations must be >= 1, got $iterations" }
+
+        val start = System.nanoTime()
+        val metrics = gblnStartupMetrics
+        val loaded = System.nanoTime()
+
+        // Check that every symbol the JNA proxy needs is exported. This is
+        // only a lookup: the proxy builds each method's invocation state on
+        // its first call, which the parse rounds below pay. Direct and
+        // Panama bindings resolved their symbols while loading.
+        if (gblnBackend == GblnBackend.JNA) {
+            val native = NativeLibrary.getInstance(libraryName)
+            for (method in GblnLibrary::class.java.declaredMethods) {
+                try {
+                    native.getFunction(method.name)
+                } catch (e: UnsatisfiedLinkError) {
+                    throw IoError("GBLN library $libraryName lacks ${method.name}: ${e.message}")
+                }
+            }
+        }
+        val bound = System.nanoTime()
+
+        var parseNanos = 0L
+        var convertNanos = 0L
+        val bytes = WARMUP_INPUT.toByteArray(Charsets.UTF_8)
+        repeat(iterations) { i ->
+            val t0 = System.nanoTime()
+            val value = if (i % 2 == 0) parseRaw(WARMUP_INPUT) else parseRaw(bytes)
+            val t1 = System.nanoTime()
+            value.use { convertAll(it) }
+            parseNanos += t1 - t0
+            convertNanos += System.nanoTime() - t1
+        }
+
+        return GblnWarmupReport(
+            backend = gblnBackend,
+            startup = metrics,
+            loadNanos = loaded - start,
+            bindNanos = bound - loaded,
+            parseNanos = parseNanos,
+            convertNanos = convertNanos,
+            iterations = iterations
+        )
+    }
+
+    private fun convertAll(value: ManagedGblnValue) {
+        val ptr: Pointer = value.ptr
+        gblnToKotlin(ptr)
+        gblnToKotlin(ptr, GblnParseOptions(primitiveArrays = true, compactObjects = true))
+        GblnDocument.from(value).root.toKotlin()
+        dev.gbln.toString(value)
+    }
+}
+
+/**
+ * Phase timings of Gbln.warmup(), in nanoseconds.
+ *
+ * @property backend FFI backend in use
+ * @property startup How the library was located and bound
+ * @property loadNanos Locating, extracting and loading libgbln (near zero
+ *   if it was already loaded)
+ * @property bindNanos Looking up every libgbln symbol (JNA backend only,
+ *   near zero otherwise); the proxy's per-method setup on first call is
+ *   counted in parseNanos
+ * @property parseNanos Total time in the native parser
+ * @property convertNanos Total time converting to Kotlin values
+ * @property iterations Number of parse/convert rounds
+ */
+data class GblnWarmupReport(
+    val backend: GblnBackend,
+    val startup: GblnStartupMetrics,
+    val loadNanos: Long,
+    val bindNanos: Long,
+    val parseNanos: Long,
+    val convertNanos: Long,
+    val iterations: Int
+) {
+    /** Sum of all phases. */
+    val totalNanos: Long get() = loadNanos + bindNanos + parseNanos + convertNanos
+}
@@ -4,7 +4,9 @@
 package dev.gbln
 
 import com.sun.jna.ptr.PointerByReference
+import java.nio.file.Files
 import java.nio.file.Path
+import java.nio.file.Paths
 
 /**
  * Write GBLN value to I/O format file.
@@ -58,16 +60,7 @@ fun writeIo(value: ManagedGblnValue, path: String, config: GblnConfig? = null) {
 
         if (err != GblnErrorCode.OK) {
             // Get error message
-            val msgPtr = lib.gbln_last_error_message()
-            val msg = if (msgPtr != null) {
-                val errorMsg = msgPtr.getString(0, "UTF-8")
-                lib.gbln_string_free(msgPtr)
-                errorMsg
-            } else {
-                "I/O error (code $err)"
-            }
-
-            throw IoError(msg)
+            throw IoError(lastErrorMessage() ?: "I/O error (code $err)")
         }
     } finally {
         // Free C config
@@ -82,6 +75,29 @@ fun writeIo(value: ManagedGblnValue, path: Path, config: GblnConfig? = null) {
     writeIo(value, path.toString(), config)
 }
 
+/**
+ * XZ stream header magic bytes.
+ */
+private val XZ_MAGIC = byteArrayOf(0xFD.toByte(), 0x37, 0x7A, 0x58, 0x5A, 0x00)
+
+/**
+ * Check whether a regular file starts with the XZ magic bytes.
+ */
+private fun isXzCompressed(file: Path): Boolean {
+    val header = ByteArray(XZ_MAGIC.size)
+    val read = Files.newInputStream(file).use { it.readNBytes(header, 0, header.size) }
+    return read == header.size && header.contentEquals(XZ_MAGIC)
+}
+
+/**
+ * Check whether a path is a regular file without XZ compression.
+ */
+private fun isUncompressed(file: Path): Boolean = try {
+    Files.isRegularFile(file) && !isXzCompressed(file)
+} catch (e: java.io.IOException) {
+    false
+}
+
 /**
  * Read GBLN file from I/O format (low-level API).
  *
@@ -89,6 +105,8 @@ fun writeIo(value: ManagedGblnValue, path: Path, config: GblnConfig? = null) {
  * Use readIo() instead if you want automatic conversion to Kotlin types.
  *
  * This function reads a file and automatically detects if it's XZ compressed.
+ * Uncompressed files go through parseFileRaw(), which memory-maps large
+ * files instead of copying them.
  *
  * @param path File path (String or Path)
  * @return ManagedGblnValue with automatic memory cleanup
@@ -96,6 +114,15 @@ fun writeIo(value: ManagedGblnValue, path: Path, config: GblnConfig? = null) {
  * @throws ParseError On invalid GBLN content
  */
 fun readIoRaw(path: String): ManagedGblnValue {
+    val file = Paths.get(path)
+    if (isUncompressed(file)) {
+        return try {
+            parseFileRaw(file)
+        } catch (e: java.io.IOException) {
+            throw IoError(e.message ?: "I/O error reading $path")
+        }
+    }
+
     val pathBytes = path.toByteArray(Charsets.UTF_8)
 
     // Prepare output pointer
@@ -106,16 +133,7 @@ fun readIoRaw(path: String): ManagedGblnValue {
 
     if (err != GblnErrorCode.OK) {
         // Get error message
-        val msgPtr = lib.gbln_last_error_message()
-        val msg = if (msgPtr != null) {
-            val errorMsg = msgPtr.getString(0, "UTF-8")
-            lib.gbln_string_free(msgPtr)
-            errorMsg
-        } else {
-            "I/O error (code $err)"
-        }
-
-        throw IoError(msg)
+        throw IoError(lastErrorMessage() ?: "I/O error (code $err)")
     }
 
     // Wrap in ManagedGblnValue for automatic cleanup
@@ -133,6 +151,7 @@ fun readIoRaw(path: String): ManagedGblnValue {
  * decompresses if detected.
  *
  * @param path File path (String or Path)
+ * @param options Result shape options
  * @return Parsed Kotlin value (Map, List, or primitive)
  * @throws IoError On file read failure
  * @throws ParseError On invalid GBLN content
@@ -146,14 +165,48 @@ fun readIoRaw(path: String): ManagedGblnValue {
  * val value2 = readIo("config.io.gbln")
  * ```
  */
-fun readIo(path: String): Any? {
-    val managedValue = readIoRaw(path)
-    return gblnToKotlin(managedValue.ptr)
+fun readIo(path: String, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
+    return readIoRaw(path).use { gblnToKotlin(it.ptr, options) }
 }
 
 /**
  * Read GBLN file from I/O format (Path overload).
  */
-fun readIo(path: Path): Any? {
-    return readIo(path.toString())
+fun readIo(path: Path, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
+    return readIo(path.toString(), options)
+}
+
+/**
+ * Read GBLN file from I/O format, keeping only the members selected by
+ * [projection] (see parse with a projection).
+ *
+ * Uncompressed files are parsed with the JVM engine, skipping the
+ * unprojected members. XZ files are decompressed and parsed natively;
+ * only the projected members of the native tree are then converted.
+ *
+ * @param path File path
+ * @param projection Keys to keep
+ * @param options Result shape options
+ * @return Parsed Kotlin value (Map or List)
+ * @throws IoError On file read failure
+ * @throws ParseError On invalid GBLN content
+ */
+fun readIo(path: String, projection: GblnProjection, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
+    val file = Paths.get(path)
+    if (!isUncompressed(file)) {
+        return readIoRaw(path).use { walkProjected(it.ptr, projection.root, options) }
+    }
+    val bytes = try {
+        Files.readAllBytes(file)
+    } catch (e: java.io.IOException) {
+        throw IoError(e.message ?: "I/O error reading $path")
+    }
+    return parse(bytes, 0, bytes.size, projection, options)
+}
+
+/**
+ * Read GBLN file from I/O format, keeping only [projection] (Path overload).
+ */
+fun readIo(path: Path, projection: GblnProjection, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
+    return readIo(path.toString(), projection, options)
 }
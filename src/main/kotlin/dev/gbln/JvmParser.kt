@@ -0,0 +1,680 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+/**
+ * Pure-JVM GBLN parser (GblnEngine.JVM).
+ *
+ * A single pass over UTF-8 bytes straight into a GblnDocument tape, with
+ * no native code involved. Accepts the same language as libgbln and
+ * reports the same GblnErrorCode values:
+ *
+ * ```
+ * document := members | '{' members '}'
+ * member   := key '<' hint '>' '(' scalar ')'     single value
+ *           | key '<' hint '>' '[' scalar* ']'    typed array
+ *           | key '{' members '}'                 object
+ *           | key '[' element* ']'                array of objects / arrays
+ * element  := '{' members '}' | '[' element* ']' | '<' hint '>' ( '(' scalar ')' | '[' scalar* ']' )
+ * hint     := i8 | i16 | i32 | i64 | u8 | u16 | u32 | u64 | f32 | f64 | b | n | s2 … s1024
+ * ```
+ *
+ * Whitespace and `:|` line comments may appear between tokens. Like
+ * gbln_parse, a document of members becomes one wrapper object.
+ *
+ * Given a StructuralIndex of the input, payloads in `(...)` are skipped
+ * by jumping to the next indexed delimiter rather than byte by byte.
+ */
+internal class JvmParser(
+    private val input: ByteArray,
+    private val start: Int = 0,
+    private val end: Int = input.size,
+    private val index: StructuralIndex? = null,
+    // Callers parsing many small documents pass a reset() builder in
+    private val tape: TapeBuilder = TapeBuilder(),
+    // Line number of start, for error messages
+    private val firstLine: Long = 1
+) {
+
+    private var pos = start
+
+    // Next unconsumed entry of index
+    private var cursor = index?.lowerBound(start) ?: 0
+
+    // Container left unparsed by parseSkeleton(): its opening delimiter
+    // position, the position after its closing one, and its tape node
+    private var spliceAt = -1
+    private var spliceEnd = 0
+    var splicedNode = -1
+        private set
+
+    // Unescaped string payloads
+    private var scratch = ByteArray(64)
+
+    // Members kept by parseProjected() at the current depth; null keeps
+    // everything
+    private var projection: GblnProjection.Node? = null
+
+    // Open brackets of a subtree being skipped
+    private var skipStack = ByteArray(16)
+
+    /**
+     * Parse the whole input.
+     *
+     * @param shared Return TapeBuilder.view() instead of a copy; the
+     *   document is then only valid until the tape is reset
+     * @throws GblnSyntaxException if the input is not valid GBLN
+     */
+    fun parse(shared: Boolean = false): GblnDocument {
+        skipWhitespace()
+        if (pos < end && input[pos] == LBRACE) {
+            pos++
+            parseObject(-1)
+            skipWhitespace()
+            if (pos < end) {
+                fail(GblnErrorCode.ERROR_UNEXPECTED_TOKEN, "Unexpected content after document")
+            }
+        } else {
+            val root = tape.node(GblnValueType.OBJECT, 0, -1)
+            tape.end(root, parseMembers(topLevel = true))
+        }
+        return if (shared) tape.view() else tape.build()
+    }
+
+    /**
+     * Parse the whole input, building only the members selected by
+     * [projection]. The others are skipped by bracket matching, unchecked.
+     *
+     * @throws GblnSyntaxException if the kept part of the input, or the
+     *   bracket structure of the rest, is not valid GBLN
+     */
+    fun parseProjected(projection: GblnProjection): GblnDocument {
+        this.projection = projection.root
+        return parse()
+    }
+
+    /**
+     * Parse the whole input except the container opening at [open] and
+     * closing at [close], which becomes an empty placeholder node
+     * (splicedNode). Used by ParallelParser.
+     */
+    fun parseSkeleton(open: Int, close: Int): GblnDocument {
+        spliceAt = open
+        spliceEnd = close + 1
+        return parse()
+    }
+
+    /**
+     * Parse the input as the members of an object ([array] false) or the
+     * elements of an untyped array, without the enclosing delimiters; the
+     * root node holds them. Used by ParallelParser for one chunk.
+     */
+    fun parseRange(array: Boolean): GblnDocument {
+        if (array) {
+            val root = tape.node(GblnValueType.ARRAY, 0, -1)
+            tape.end(root, parseElements(untilEnd = true))
+        } else {
+            val root = tape.node(GblnValueType.OBJECT, 0, -1)
+            tape.end(root, parseMembers(topLevel = true))
+        }
+        return tape.build()
+    }
+
+    // Structure
+
+    /**
+     * Parse members up to the closing brace (or end of input at top level).
+     *
+     * @return number of members
+     */
+    private fun parseMembers(topLevel: Boolean): Int {
+        var count = 0
+        var keys = IntArray(8)
+        var keySet: HashSet<Int>? = null
+
+        while (true) {
+            skipWhitespace()
+            if (pos >= end) {
+                if (topLevel) return count
+                fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected '}'")
+            }
+            if (input[pos] == RBRACE) {
+                if (topLevel) fail(GblnErrorCode.ERROR_UNEXPECTED_TOKEN, "Unexpected '}'")
+                pos++
+                return count
+            }
+
+            val keyStart = pos
+            scanKey()
+            val projected = projection
+            val kept = projected?.child(input, keyStart, pos)
+            if (projected != null && kept == null) {
+                skipMemberValue()
+                continue
+            }
+            val key = tape.key(input, keyStart, pos - keyStart)
+
+            // Keys are interned by the tape, so equal keys have equal indices
+            val duplicate = keySet?.let { !it.add(key) } ?: (0 until count).any { keys[it] == key }
+            if (duplicate) {
+                pos = keyStart
+                fail(GblnErrorCode.ERROR_DUPLICATE_KEY, "Duplicate key: ${tape.keyString(key)}")
+            }
+            if (keySet == null) {
+                if (count < LINEAR_KEY_CHECK) {
+                    if (count == keys.size) keys = keys.copyOf(count * 2)
+                    keys[count] = key
+                } else {
+                    keySet = HashSet<Int>().apply {
+                        for (i in 0 until count) add(keys[i])
+                        add(key)
+                    }
+                }
+            }
+
+            projection = if (kept == null || kept.keepAll) null else kept
+            parseMemberValue(key)
+            projection = projected
+            count++
+        }
+    }
+
+    private fun scanKey() {
+        val keyStart = pos
+        while (pos < end && isKeyByte(input[pos])) {
+            pos++
+        }
+        if (pos == keyStart) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected key, found ${describe(pos)}")
+        }
+    }
+
+    private fun parseMemberValue(key: Int) {
+        skipWhitespace()
+        if (pos >= end) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input after key")
+        }
+        when (input[pos]) {
+            LANGLE -> parseTyped(key)
+            LBRACE -> {
+                pos++
+                parseObject(key)
+            }
+            LBRACKET -> {
+                pos++
+                parseArray(key)
+            }
+            else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected '<', '{' or '[', found ${describe(pos)}")
+        }
+    }
+
+    private fun parseObject(key: Int) {
+        if (spliced(GblnValueType.OBJECT, key)) return
+        val index = tape.node(GblnValueType.OBJECT, 0, key)
+        tape.end(index, parseMembers(topLevel = false))
+    }
+
+    private fun parseArray(key: Int) {
+        if (spliced(GblnValueType.ARRAY, key)) return
+        val index = tape.node(GblnValueType.ARRAY, 0, key)
+        tape.end(index, parseElements(untilEnd = false))
+    }
+
+    /**
+     * Emit the parseSkeleton() placeholder if the container just opened
+     * (at pos - 1) is the spliced one.
+     */
+    private fun spliced(type: Int, key: Int): Boolean {
+        if (pos - 1 != spliceAt) {
+            return false
+        }
+        splicedNode = tape.node(type, 0, key)
+        tape.end(splicedNode, 0)
+        pos = spliceEnd
+        // Jump over the region's index entries instead of seeking through them
+        index?.let { cursor = it.lowerBound(spliceEnd) }
+        return true
+    }
+
+    /**
+     * Elements of an untyped array (objects, nested arrays or typed
+     * elements) up to ']', or up to the end of input with [untilEnd].
+     *
+     * @return number of elements
+     */
+    private fun parseElements(untilEnd: Boolean): Int {
+        var count = 0
+        while (true) {
+            skipWhitespace()
+            if (pos >= end) {
+                if (untilEnd) return count
+                fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected ']'")
+            }
+            when (input[pos]) {
+                RBRACKET -> {
+                    if (untilEnd) fail(GblnErrorCode.ERROR_UNEXPECTED_TOKEN, "Unexpected ']'")
+                    pos++
+                    return count
+                }
+                LBRACE -> {
+                    pos++
+                    parseObject(-1)
+                }
+                LBRACKET -> {
+                    pos++
+                    parseArray(-1)
+                }
+                LANGLE -> parseTyped(-1)
+                else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected array element, found ${describe(pos)}")
+            }
+            count++
+        }
+    }
+
+    /**
+     * `<hint>(value)` or `<hint>[values]`, with pos on '<'.
+     */
+    private fun parseTyped(key: Int) {
+        val hint = parseHint()
+        skipWhitespace()
+        if (pos >= end) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input after type hint")
+        }
+        when (input[pos]) {
+            LPAREN -> parseParenthesised(hint, key)
+            LBRACKET -> parseTypedArray(hint, key)
+            else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected '(' or '[', found ${describe(pos)}")
+        }
+    }
+
+    private fun parseTypedArray(hint: Int, key: Int) {
+        pos++
+        val index = tape.node(GblnValueType.ARRAY, 0, key, hint)
+        var count = 0
+        while (true) {
+            skipWhitespace()
+            if (pos >= end) {
+                fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected ']'")
+            }
+            val b = input[pos]
+            if (b == RBRACKET) {
+                pos++
+                tape.end(index, count)
+                return
+            }
+            if (b == LPAREN) {
+                parseParenthesised(hint, -1)
+            } else {
+                val tokenStart = pos
+                while (pos < end && !isWhitespace(input[pos]) && input[pos] != RBRACKET) {
+                    if (isStructural(input[pos])) {
+                        fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Unexpected ${describe(pos)} in array")
+                    }
+                    pos++
+                }
+                appendScalar(hint, tokenStart, pos, escaped = false, key = -1)
+            }
+            count++
+        }
+    }
+
+    /**
+     * `(payload)`, with pos on '('.
+     */
+    private fun parseParenthesised(hint: Int, key: Int) {
+        val open = pos
+        pos++
+        val payloadStart = pos
+        var escaped = false
+        val index = index
+        if (index != null) {
+            escaped = seekParen(index)
+        } else {
+            while (pos < end && input[pos] != RPAREN) {
+                if (input[pos] == BACKSLASH && pos + 1 < end) {
+                    escaped = true
+                    pos++
+                }
+                pos++
+            }
+        }
+        if (pos >= end) {
+            pos = open
+            fail(GblnErrorCode.ERROR_UNTERMINATED_STRING, "Missing ')'")
+        }
+        val payloadEnd = pos
+        pos++
+        appendScalar(hint, payloadStart, payloadEnd, escaped, key)
+    }
+
+    /**
+     * Move pos to the closing ')' (or end) using the index, honouring
+     * backslash escapes; returns true if the payload had any.
+     */
+    private fun seekParen(index: StructuralIndex): Boolean {
+        val positions = index.positions
+        var escaped = false
+        var i = index.seek(cursor, pos)
+        while (i < index.size) {
+            val p = positions[i++]
+            if (p < pos) continue // the byte after a backslash
+            val b = input[p]
+            if (b == RPAREN) {
+                cursor = i
+                pos = p
+                return escaped
+            }
+            if (b == BACKSLASH && p + 1 < end) {
+                escaped = true
+                pos = p + 2
+            }
+        }
+        cursor = i
+        pos = end
+        return escaped
+    }
+
+    // Skipping (parseProjected)
+
+    /**
+     * Skip a member value without building it, with pos after the key.
+     */
+    private fun skipMemberValue() {
+        skipWhitespace()
+        if (pos >= end) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input after key")
+        }
+        when (input[pos]) {
+            LANGLE -> skipTyped()
+            LBRACE, LBRACKET -> skipContainer()
+            else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected '<', '{' or '[', found ${describe(pos)}")
+        }
+    }
+
+    /**
+     * Skip `{...}` or `[...]`, with pos on the opening bracket. Only
+     * brackets are matched; payloads and comments are stepped over.
+     */
+    private fun skipContainer() {
+        var depth = 0
+        while (true) {
+            pos = nextSkipDelimiter()
+            if (pos >= end) {
+                val open = skipStack[depth - 1]
+                fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected '${if (open == LBRACE) '}' else ']'}'")
+            }
+            when (val b = input[pos]) {
+                LBRACE, LBRACKET -> {
+                    if (depth == skipStack.size) skipStack = skipStack.copyOf(depth * 2)
+                    skipStack[depth++] = b
+                    pos++
+                }
+                RBRACE, RBRACKET -> {
+                    if (skipStack[depth - 1] != (if (b == RBRACE) LBRACE else LBRACKET)) {
+                        fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Unexpected ${describe(pos)}")
+                    }
+                    pos++
+                    if (--depth == 0) return
+                }
+                LPAREN -> skipParen()
+                LANGLE -> skipTyped()
+                COLON -> if (pos + 1 < end && input[pos + 1] == PIPE) skipWhitespace() else pos++
+                else -> pos++
+            }
+        }
+    }
+
+    /**
+     * Position of the next byte at or after pos that skipContainer() acts
+     * on: a bracket, '(', '<' or ':'. Uses the structural index if given.
+     */
+    private fun nextSkipDelimiter(): Int {
+        val index = index
+        if (index != null) {
+            val positions = index.positions
+            var i = index.seek(cursor, pos)
+            while (i < index.size) {
+                val p = positions[i]
+                val b = input[p]
+                if (b != RPAREN && b != RANGLE && b != BACKSLASH) {
+                    cursor = i
+                    return p
+                }
+                i++
+            }
+            cursor = i
+            return end
+        }
+        var p = pos
+        while (p < end) {
+            val b = input[p]
+            if (b == LBRACE || b == RBRACE || b == LBRACKET || b == RBRACKET || b == LPAREN || b == LANGLE || b == COLON) {
+                return p
+            }
+            p++
+        }
+        return end
+    }
+
+    /**
+     * Skip `<hint>(value)` or `<hint>[values]`, unchecked, with pos on '<'.
+     */
+    private fun skipTyped() {
+        while (pos < end && input[pos] != RANGLE) pos++
+        if (pos >= end) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unterminated type hint")
+        }
+        pos++
+        skipWhitespace()
+        if (pos >= end) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input after type hint")
+        }
+        when (input[pos]) {
+            LPAREN -> skipParen()
+            LBRACKET -> {
+                pos++
+                while (true) {
+                    skipWhitespace()
+                    if (pos >= end) {
+                        fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected ']'")
+                    }
+                    when (input[pos]) {
+                        RBRACKET -> {
+                            pos++
+                            return
+                        }
+                        LPAREN -> skipParen()
+                        else -> while (pos < end && !isWhitespace(input[pos]) && input[pos] != RBRACKET) pos++
+                    }
+                }
+            }
+            else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected '(' or '[', found ${describe(pos)}")
+        }
+    }
+
+    /**
+     * Skip `(payload)`, unchecked, with pos on '('.
+     */
+    private fun skipParen() {
+        val open = pos
+        pos++
+        val index = index
+        if (index != null) {
+            seekParen(index)
+        } else {
+            while (pos < end && input[pos] != RPAREN) {
+                if (input[pos] == BACKSLASH && pos + 1 < end) pos++
+                pos++
+            }
+        }
+        if (pos >= end) {
+            pos = open
+            fail(GblnErrorCode.ERROR_UNTERMINATED_STRING, "Missing ')'")
+        }
+        pos++
+    }
+
+    // Type hints and scalars
+
+    /**
+     * Parse `<hint>`; returns the value type, with the sN bound above bit 8.
+     */
+    private fun parseHint(): Int {
+        val open = pos
+        pos++
+        val hintStart = pos
+        while (pos < end && input[pos] != RANGLE) {
+            if (isStructural(input[pos]) || isWhitespace(input[pos])) break
+            pos++
+        }
+        if (pos >= end) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unterminated type hint")
+        }
+        if (input[pos] != RANGLE) {
+            fail(GblnErrorCode.ERROR_INVALID_TYPE_HINT, "Unterminated type hint")
+        }
+        val hintEnd = pos
+        pos++
+        return located(open) { GblnScalars.hint(input, hintStart, hintEnd) }
+    }
+
+    private fun appendScalar(hint: Int, from: Int, to: Int, escaped: Boolean, key: Int) {
+        val type = hint and 0xFF
+        if (type == GblnValueType.STRING) {
+            appendString(hint ushr 8, from, to, escaped, key)
+            return
+        }
+        val word = located(from) {
+            when (type) {
+                GblnValueType.BOOL -> if (GblnScalars.parseBoolean(input, from, to)) 1L else 0L
+                GblnValueType.NULL -> {
+                    GblnScalars.checkNull(input, from, to)
+                    0L
+                }
+                GblnValueType.F32 -> GblnScalars.parseFloat(input, from, to).toRawBits().toLong()
+                GblnValueType.F64 -> GblnScalars.parseDouble(input, from, to).toRawBits()
+                else -> GblnScalars.parseInteger(type, input, from, to)
+            }
+        }
+        tape.node(type, word, key, hint)
+    }
+
+    private fun appendString(bound: Int, from: Int, to: Int, escaped: Boolean, key: Int) {
+        var bytes = input
+        var offset = from
+        var length = to - from
+        if (escaped) {
+            if (scratch.size < length) {
+                scratch = ByteArray(maxOf(length, scratch.size * 2))
+            }
+            length = GblnScalars.unescape(input, from, to, scratch)
+            bytes = scratch
+            offset = 0
+        }
+
+        located(from) { GblnScalars.checkLength(bound, bytes, offset, offset + length) }
+        tape.node(GblnValueType.STRING, tape.string(bytes, offset, length).toLong(), key, GblnValueType.STRING or (bound shl 8))
+    }
+
+    // Lexing
+
+    private fun skipWhitespace() {
+        while (pos < end) {
+            val b = input[pos]
+            if (isWhitespace(b)) {
+                pos++
+            } else if (b == COLON && pos + 1 < end && input[pos + 1] == PIPE) {
+                while (pos < end && input[pos] != NEWLINE) pos++
+            } else {
+                return
+            }
+        }
+    }
+
+    private fun isWhitespace(b: Byte): Boolean = GblnScalars.isWhitespace(b)
+
+    private fun isStructural(b: Byte): Boolean =
+        b == LBRACE || b == RBRACE || b == LBRACKET || b == RBRACKET ||
+            b == LPAREN || b == RPAREN || b == LANGLE || b == RANGLE
+
+    private fun isKeyByte(b: Byte): Boolean = !isWhitespace(b) && !isStructural(b) && b != COLON
+
+    // Errors
+
+    /**
+     * Run a GblnScalars decoder, reporting its errors at [at].
+     */
+    private inline fun <T> located(at: Int, decode: () -> T): T = try {
+        decode()
+    } catch (e: GblnSyntaxException) {
+        pos = at
+        fail(e.code, e.message!!)
+    }
+
+    private fun describe(at: Int): String =
+        if (at >= end) "end of input" else "'${String(input, at, 1, Charsets.ISO_8859_1)}'"
+
+    /**
+     * Throw [code] with the line and column of pos.
+     */
+    private fun fail(code: Int, message: String): Nothing {
+        var line = firstLine
+        var lineStart = start
+        for (i in start until minOf(pos, end)) {
+            if (input[i] == NEWLINE) {
+                line++
+                lineStart = i + 1
+            }
+        }
+        throw GblnSyntaxException(code, "$message at line $line, column ${pos - lineStart + 1}")
+    }
+
+    companion object {
+        private const val LBRACE = '{'.code.toByte()
+        private const val RBRACE = '}'.code.toByte()
+        private const val LBRACKET = '['.code.toByte()
+        private const val RBRACKET = ']'.code.toByte()
+        private const val LPAREN = '('.code.toByte()
+        private const val RPAREN = ')'.code.toByte()
+        private const val LANGLE = '<'.code.toByte()
+        private const val RANGLE = '>'.code.toByte()
+        private const val COLON = ':'.code.toByte()
+        private const val PIPE = '|'.code.toByte()
+        private const val BACKSLASH = '\\'.code.toByte()
+        private const val NEWLINE = '\n'.code.toByte()
+
+        /** Objects up to this many keys are checked for duplicates linearly. */
+        private const val LINEAR_KEY_CHECK = 16
+
+        /**
+         * Parse UTF-8 GBLN into a document, building a structural index
+         * first when the input reaches structuralIndexThreshold.
+         *
+         * @param projection Members to keep (see parseProjected); null keeps all
+         * @throws GblnSyntaxException if the input is not valid GBLN
+         */
+        fun parse(
+            bytes: ByteArray,
+            offset: Int = 0,
+            length: Int = bytes.size - offset,
+            projection: GblnProjection? = null
+        ): GblnDocument {
+            val index = if (length >= structuralIndexThreshold) {
+                structuralScanner.scan(bytes, offset, offset + length)
+            } else {
+                null
+            }
+            val parser = JvmParser(bytes, offset, offset + length, index)
+            return if (projection != null) parser.parseProjected(projection) else parser.parse()
+        }
+    }
+}
+
+/**
+ * Rejection by the JVM parser. Internal and stackless: parse() turns it
+ * into a ParseError and tryParse() into a Failure.
+ */
+internal class GblnSyntaxException(val code: Int, message: String) : RuntimeException(message, null, false, false) {
+    fun toParseError(): ParseError = ParseError(message!!, code)
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Memory
+import com.sun.jna.Pointer
+import java.nio.ByteBuffer
+
+/**
+ * Process-wide intern table for object keys.
+ *
+ * Documents repeat a small set of keys over and over. Keys are looked up
+ * by their raw UTF-8 bytes, so a repeated key costs one hash and one byte
+ * comparison and yields the same String instance every time, with no
+ * decoding and no garbage.
+ *
+ * The table is direct-mapped with a fixed number of slots (a colliding key
+ * replaces the previous one) and only holds keys up to [MAX_KEY_BYTES], so
+ * its memory is bounded whatever the input. Entries are immutable and
+ * published through final fields, so lookups need no locking; a lost
+ * update only costs a later miss. Set the slot count with
+ * -Dgbln.internKeys=<n> (rounded up to a power of two, 0 disables).
+ */
+internal object KeyInterner {
+
+    /** Longer keys are decoded every time. */
+    const val MAX_KEY_BYTES = 64
+
+    private const val DEFAULT_SLOTS = 4096
+
+    private class Entry(val hash: Int, val bytes: ByteArray, val string: String)
+
+    private val slots: Array<Entry?> = arrayOfNulls(internSlots("gbln.internKeys", DEFAULT_SLOTS))
+    private val mask = slots.size - 1
+
+    /**
+     * Key for the UTF-8 bytes `bytes[offset until offset + length]`.
+     */
+    fun intern(bytes: ByteArray, offset: Int, length: Int): String {
+        if (length > MAX_KEY_BYTES || slots.isEmpty()) {
+            return String(bytes, offset, length, Charsets.UTF_8)
+        }
+
+        var hash = 1
+        for (i in offset until offset + length) {
+            hash = 31 * hash + bytes[i]
+        }
+
+        val slot = (hash xor (hash ushr 16)) and mask
+        val entry = slots[slot]
+        if (entry != null && entry.hash == hash &&
+            java.util.Arrays.equals(entry.bytes, 0, entry.bytes.size, bytes, offset, offset + length)
+        ) {
+            return entry.string
+        }
+
+        val copy = bytes.copyOfRange(offset, offset + length)
+        val string = String(copy, Charsets.UTF_8)
+        slots[slot] = Entry(hash, copy, string)
+        return string
+    }
+
+    /**
+     * Key for the NUL-terminated UTF-8 string at [str].
+     */
+    fun intern(str: Pointer): String {
+        if (slots.isEmpty()) {
+            return readUtf8(str)
+        }
+
+        // Hash while looking for the terminator; give up on long keys.
+        // JNA bounds-checks views of its own allocations
+        val window = minOf(MAX_KEY_BYTES + 1L, (str as? Memory)?.size() ?: Long.MAX_VALUE).toInt()
+        val buf: ByteBuffer = str.getByteBuffer(0, window.toLong())
+        var hash = 1
+        var length = 0
+        while (true) {
+            if (length == window) return readUtf8(str)
+            val b = buf.get(length)
+            if (b == 0.toByte()) break
+            if (length == MAX_KEY_BYTES) return readUtf8(str)
+            hash = 31 * hash + b
+            length++
+        }
+
+        val slot = (hash xor (hash ushr 16)) and mask
+        val entry = slots[slot]
+        if (entry != null && entry.hash == hash && entry.bytes.size == length && matches(entry.bytes, buf)) {
+            return entry.string
+        }
+
+        val copy = ByteArray(length)
+        buf.get(0, copy)
+        val string = String(copy, Charsets.UTF_8)
+        slots[slot] = Entry(hash, copy, string)
+        return string
+    }
+
+    private fun matches(bytes: ByteArray, buf: ByteBuffer): Boolean {
+        for (i in bytes.indices) {
+            if (bytes[i] != buf.get(i)) return false
+        }
+        return true
+    }
+}
+
+/**
+ * Slot count of an intern table from system property [property]:
+ * rounded up to a power of two and capped at 2^20, 0 if disabled.
+ */
+internal fun internSlots(property: String, defaultSlots: Int): Int {
+    val requested = System.getProperty(property)?.toIntOrNull() ?: defaultSlots
+    if (requested <= 0) {
+        return 0
+    }
+    val capped = minOf(requested, 1 shl 20)
+    return if (capped == 1) 1 else Integer.highestOneBit(capped - 1) shl 1
+}
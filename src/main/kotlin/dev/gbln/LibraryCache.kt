@@ -0,0 +1,206 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import java.io.IOException
+import java.io.InputStream
+import java.nio.channels.FileChannel
+import java.nio.file.AtomicMoveNotSupportedException
+import java.nio.file.FileSystems
+import java.nio.file.Files
+import java.nio.file.LinkOption
+import java.nio.file.Path
+import java.nio.file.Paths
+import java.nio.file.StandardCopyOption
+import java.nio.file.StandardOpenOption
+import java.nio.file.attribute.PosixFilePermission
+import java.nio.file.attribute.PosixFilePermissions
+import java.nio.file.attribute.UserPrincipal
+import java.security.DigestInputStream
+import java.security.MessageDigest
+
+/**
+ * Persistent cache for the libgbln bundled in the JAR.
+ *
+ * Instead of copying the library to a new temp file in every JVM, it is
+ * extracted once to `<cache root>/v1/<sha256>/<library name>` and reused
+ * by every later process. The directory name is the SHA-256 of the library
+ * itself, so different versions never collide and a cached file can never
+ * be stale.
+ *
+ * The hash is read from a `<library>.sha256` resource written at build
+ * time, so a cache hit costs one small resource read and a few stats, and
+ * never reads the library bytes. Without the sidecar the resource is
+ * hashed first.
+ *
+ * That hit is only trusted if the cached file and every directory up to
+ * the cache root belong to the current user and nobody else can write
+ * them; directories are created owner-only where the file system supports
+ * POSIX permissions. If the root points somewhere shared (`gbln.cacheDir`
+ * / GBLN_CACHE_DIR), the cached file is hashed again before every use and
+ * replaced if it does not match.
+ *
+ * The first writer takes an exclusive lock on `<dir>/.lock`, writes to a
+ * temp file in the same directory, checks the hash of what it wrote and
+ * renames it into place atomically. Other processes either wait on the
+ * lock or see the finished file; nobody ever loads a partial copy.
+ *
+ * The cache root is `gbln.cacheDir` / GBLN_CACHE_DIR if set, otherwise
+ * `$XDG_CACHE_HOME/gbln` or `~/.cache/gbln`.
+ */
+internal object LibraryCache {
+
+    /** Bumped if the directory layout changes. */
+    private const val LAYOUT = "v1"
+
+    /**
+     * Outcome of [extract].
+     */
+    class Entry(val path: Path, val hit: Boolean)
+
+    /**
+     * Path of the cached copy of the resource [resourcePath], extracting
+     * it if this is the first process to need it.
+     *
+     * @return the cached library, or null if the resource does not exist
+     * @throws IOException if the cache directory cannot be used
+     */
+    @Synchronized
+    fun extract(resourcePath: String, libName: String): Entry? {
+        val hash = bundledHash(resourcePath) ?: return null
+        val root = root()
+        val dir = root.resolve(LAYOUT).resolve(hash)
+        val target = dir.resolve(libName)
+        if (valid(target, root, hash)) {
+            return Entry(target, hit = true)
+        }
+
+        createPrivateDirectories(dir)
+        FileChannel.open(dir.resolve(".lock"), StandardOpenOption.CREATE, StandardOpenOption.WRITE).use { channel ->
+            channel.lock().use {
+                // Another process may have finished while we waited
+                if (valid(target, root, hash)) {
+                    return Entry(target, hit = true)
+                }
+
+                val temp = Files.createTempFile(dir, libName, ".tmp")
+                try {
+                    val written = resource(resourcePath)?.use { input ->
+                        Files.newOutputStream(temp).use { output -> copyHashing(input, output) }
+                    } ?: return null
+                    if (written != hash) {
+                        throw IOException("Bundled library $resourcePath does not match its hash")
+                    }
+                    move(temp, target)
+                } finally {
+                    Files.deleteIfExists(temp)
+                }
+            }
+        }
+        return Entry(target, hit = false)
+    }
+
+    /**
+     * True if [file] is a usable copy of the library with SHA-256 [hash]:
+     * either the cache is [ownerOnly], so the directory name can be trusted,
+     * or its content actually hashes to [hash].
+     */
+    private fun valid(file: Path, root: Path, hash: String): Boolean {
+        if (!Files.isRegularFile(file)) {
+            return false
+        }
+        if (ownerOnly(file, root)) {
+            return true
+        }
+        return Files.newInputStream(file).use { copyHashing(it, java.io.OutputStream.nullOutputStream()) } == hash
+    }
+
+    /**
+     * True if [file] and each directory above it up to [root] belong to
+     * the current user and are not writable by group or others.
+     */
+    private fun ownerOnly(file: Path, root: Path): Boolean {
+        val user = currentUser ?: return false
+        val posix = FileSystems.getDefault().supportedFileAttributeViews().contains("posix")
+        return try {
+            var path: Path? = file
+            while (path != null) {
+                if (Files.getOwner(path, LinkOption.NOFOLLOW_LINKS) != user) {
+                    return false
+                }
+                if (posix) {
+                    val permissions = Files.getPosixFilePermissions(path, LinkOption.NOFOLLOW_LINKS)
+                    if (PosixFilePermission.GROUP_WRITE in permissions || PosixFilePermission.OTHERS_WRITE in permissions) {
+                        return false
+                    }
+                }
+                if (path == root) {
+                    break
+                }
+                path = path.parent
+            }
+            true
+        } catch (e: IOException) {
+            false
+        } catch (e: UnsupportedOperationException) {
+            false
+        }
+    }
+
+    private val currentUser: UserPrincipal? by lazy {
+        try {
+            FileSystems.getDefault().userPrincipalLookupService.lookupPrincipalByName(System.getProperty("user.name"))
+        } catch (e: IOException) {
+            null
+        } catch (e: UnsupportedOperationException) {
+            null
+        }
+    }
+
+    private fun createPrivateDirectories(dir: Path) {
+        if (Files.isDirectory(dir)) {
+            return
+        }
+        if (FileSystems.getDefault().supportedFileAttributeViews().contains("posix")) {
+            Files.createDirectories(dir, PosixFilePermissions.asFileAttribute(PosixFilePermissions.fromString("rwx------")))
+        } else {
+            Files.createDirectories(dir)
+        }
+    }
+
+    private fun root(): Path {
+        (System.getProperty("gbln.cacheDir") ?: System.getenv("GBLN_CACHE_DIR"))?.let { return Paths.get(it) }
+        System.getenv("XDG_CACHE_HOME")?.takeIf { it.isNotEmpty() }?.let { return Paths.get(it, "gbln") }
+        return Paths.get(System.getProperty("user.home"), ".cache", "gbln")
+    }
+
+    private fun resource(path: String): InputStream? = LibraryCache::class.java.getResourceAsStream(path)
+
+    /**
+     * Hex SHA-256 of the bundled library, from its sidecar if present.
+     */
+    private fun bundledHash(resourcePath: String): String? {
+        resource("$resourcePath.sha256")?.use { input ->
+            val text = input.readBytes().toString(Charsets.US_ASCII).trim().substringBefore(' ')
+            if (text.length == 64) {
+                return text.lowercase()
+            }
+        }
+        return resource(resourcePath)?.use { copyHashing(it, java.io.OutputStream.nullOutputStream()) }
+    }
+
+    private fun copyHashing(input: InputStream, output: java.io.OutputStream): String {
+        val digest = MessageDigest.getInstance("SHA-256")
+        DigestInputStream(input, digest).copyTo(output)
+        return digest.digest().joinToString("") { "%02x".format(it) }
+    }
+
+    private fun move(source: Path, target: Path) {
+        try {
+            Files.move(source, target, StandardCopyOption.ATOMIC_MOVE)
+        } catch (e: AtomicMoveNotSupportedException) {
+            Files.move(source, target, StandardCopyOption.REPLACE_EXISTING)
+        }
+    }
+}
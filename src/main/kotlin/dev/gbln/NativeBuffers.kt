@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Memory
+import com.sun.jna.Native
+import com.sun.jna.Pointer
+import java.nio.ByteBuffer
+
+/**
+ * Pooled native input buffers.
+ *
+ * libgbln reads NUL-terminated UTF-8. Byte inputs that are not already in
+ * NUL-terminated native memory are copied once into a per-thread buffer
+ * that is reused across parses, so steady-state parsing allocates no
+ * native memory. Inputs above [MAX_POOLED_BYTES] get a one-off buffer
+ * that is released straight after the call.
+ */
+internal object NativeBuffers {
+
+    /** Largest buffer kept per thread between calls. */
+    const val MAX_POOLED_BYTES = 4 * 1024 * 1024
+
+    private val pool = ThreadLocal<Memory?>()
+
+    /**
+     * Run [block] with [length] bytes of [bytes] copied into NUL-terminated
+     * native memory.
+     */
+    inline fun <T> withInput(bytes: ByteArray, offset: Int, length: Int, block: (Pointer) -> T): T {
+        val memory = acquire(length)
+        try {
+            memory.write(0, bytes, offset, length)
+            memory.setByte(length.toLong(), 0)
+            return block(memory)
+        } finally {
+            release(memory)
+        }
+    }
+
+    /**
+     * Run [block] with the remaining bytes of [buffer] as NUL-terminated
+     * native memory.
+     *
+     * A direct buffer whose byte just past the limit is already NUL is
+     * passed through without copying. Anything else is copied once. The
+     * buffer's position and limit are left untouched.
+     */
+    inline fun <T> withInput(buffer: ByteBuffer, block: (Pointer) -> T): T {
+        val length = buffer.remaining()
+
+        // Absolute get() stops at the limit, so peek through a widened view
+        if (buffer.isDirect && buffer.limit() < buffer.capacity() &&
+            buffer.duplicate().limit(buffer.limit() + 1).get(buffer.limit()) == 0.toByte()
+        ) {
+            return block(Native.getDirectBufferPointer(buffer).share(buffer.position().toLong()))
+        }
+
+        if (buffer.hasArray()) {
+            return withInput(buffer.array(), buffer.arrayOffset() + buffer.position(), length, block)
+        }
+
+        val memory = acquire(length)
+        try {
+            memory.getByteBuffer(0, length.toLong()).put(buffer.duplicate())
+            memory.setByte(length.toLong(), 0)
+            return block(memory)
+        } finally {
+            release(memory)
+        }
+    }
+
+    /**
+     * Borrow a buffer with room for [length] bytes plus the terminator.
+     */
+    fun acquire(length: Int): Memory {
+        val size = length.toLong() + 1
+        if (size > MAX_POOLED_BYTES) {
+            return Memory(size)
+        }
+
+        val pooled = pool.get()
+        pool.set(null)
+        if (pooled != null && pooled.size() >= size) {
+            return pooled
+        }
+
+        // Grow in powers of two so a slowly growing input reallocates rarely
+        pooled?.close()
+        return Memory(maxOf(64L, Integer.highestOneBit(size.toInt() - 1).toLong() shl 1))
+    }
+
+    /**
+     * Return a buffer obtained from [acquire].
+     */
+    fun release(memory: Memory) {
+        if (memory.size() > MAX_POOLED_BYTES) {
+            memory.close()
+            return
+        }
+
+        // A nested parse may have pooled its own buffer meanwhile
+        pool.get()?.close()
+        pool.set(memory)
+    }
+}
@@ -0,0 +1,230 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Pointer
+import java.lang.ref.Reference
+
+/**
+ * Lazy, navigable view over a parsed GBLN value.
+ *
+ * Nothing is converted up front: each access makes only the FFI calls it
+ * needs, so reading a few fields of a large document costs time
+ * proportional to what is touched. Child nodes are cached on first access.
+ *
+ * Nodes borrow memory from the ManagedGblnValue they came from. Every
+ * access checks that value is still open and throws IllegalStateException
+ * otherwise, so a node never touches freed memory. Closing the value while
+ * another thread is reading a node is not supported.
+ *
+ * Example:
+ * ```kotlin
+ * parseRaw(input).use { value ->
+ *     val port = value.node()["config"]["port"].asLong()
+ *     val hosts = value.node()["hosts"].map { it.asString() }
+ * }
+ * ```
+ */
+class GblnNode internal constructor(
+    private val owner: ManagedGblnValue,
+    private val nodePtr: Pointer
+) : Iterable<GblnNode> {
+
+    private var cachedType = -1
+    private var cachedSize = -1
+    private var cachedKeys: Array<String>? = null
+    private var children: HashMap<String, GblnNode?>? = null
+    private var elements: Array<GblnNode?>? = null
+
+    /**
+     * Run [block] on the node pointer while the owning value is open
+     * and reachable.
+     */
+    private inline fun <T> access(block: (Pointer) -> T): T {
+        // Throws if the owner has been closed
+        owner.ptr
+        try {
+            return block(nodePtr)
+        } finally {
+            Reference.reachabilityFence(owner)
+        }
+    }
+
+    /**
+     * Value type discriminant (see GblnValueType).
+     */
+    val type: Int
+        get() {
+            if (cachedType < 0) {
+                cachedType = access { lib.gbln_value_type(it) }
+            }
+            return cachedType
+        }
+
+    val isNull: Boolean get() = type == GblnValueType.NULL
+    val isObject: Boolean get() = type == GblnValueType.OBJECT
+    val isArray: Boolean get() = type == GblnValueType.ARRAY
+
+    /**
+     * Number of fields (object) or elements (array); 0 for scalars.
+     */
+    val size: Int
+        get() {
+            if (cachedSize < 0) {
+                cachedSize = when (type) {
+                    GblnValueType.OBJECT -> access { lib.gbln_object_len(it) }.toInt()
+                    GblnValueType.ARRAY -> access { lib.gbln_array_len(it) }.toInt()
+                    else -> 0
+                }
+            }
+            return cachedSize
+        }
+
+    /**
+     * Object keys in document order.
+     *
+     * @throws ValidationError if this node is not an object
+     */
+    val keys: List<String>
+        get() {
+            expect(GblnValueType.OBJECT)
+            val keys = cachedKeys ?: access { readObjectKeys(it) }.also { cachedKeys = it }
+            return keys.asList()
+        }
+
+    /**
+     * Object field by key.
+     *
+     * @throws ValidationError if this node is not an object or has no such key
+     */
+    operator fun get(key: String): GblnNode =
+        getOrNull(key) ?: throw ValidationError("No such key: $key")
+
+    /**
+     * Object field by key, or null if absent.
+     *
+     * @throws ValidationError if this node is not an object
+     */
+    fun getOrNull(key: String): GblnNode? {
+        expect(GblnValueType.OBJECT)
+        val cache = children ?: HashMap<String, GblnNode?>().also { children = it }
+        if (cache.containsKey(key)) {
+            return cache[key]
+        }
+
+        val child = access { ptr ->
+            val childPtr = lib.gbln_object_get(ptr, key)
+            if (childPtr != null && Pointer.nativeValue(childPtr) != 0L) GblnNode(owner, childPtr) else null
+        }
+        cache[key] = child
+        return child
+    }
+
+    /**
+     * Array element by index.
+     *
+     * @throws ValidationError if this node is not an array
+     * @throws IndexOutOfBoundsException if index is outside 0 until size
+     */
+    operator fun get(index: Int): GblnNode {
+        expect(GblnValueType.ARRAY)
+        val count = size
+        if (index < 0 || index >= count) {
+            throw IndexOutOfBoundsException("Index $index, size $count")
+        }
+
+        val cache = elements ?: arrayOfNulls<GblnNode>(count).also { elements = it }
+        cache[index]?.let { return it }
+
+        val child = access { ptr ->
+            val elemPtr = lib.gbln_array_get(ptr, index.toLong())
+            if (elemPtr == null || Pointer.nativeValue(elemPtr) == 0L) {
+                throw ValidationError("Missing array element $index")
+            }
+            GblnNode(owner, elemPtr)
+        }
+        cache[index] = child
+        return child
+    }
+
+    /**
+     * Iterate object field values (in key order) or array elements.
+     * Scalars have no children.
+     */
+    override fun iterator(): Iterator<GblnNode> = when (type) {
+        GblnValueType.OBJECT -> keys.asSequence().map { get(it) }.iterator()
+        GblnValueType.ARRAY -> (0 until size).asSequence().map { get(it) }.iterator()
+        else -> emptyList<GblnNode>().iterator()
+    }
+
+    /**
+     * Integer value of any width as Long (u64 keeps its bit pattern).
+     *
+     * @throws ValidationError if this node is not an integer
+     */
+    fun asLong(): Long = access { readLong(it, type) }
+
+    /**
+     * Integer value as Int.
+     *
+     * @throws ValidationError if this node is not an integer or does not fit
+     */
+    fun asInt(): Int {
+        val value = asLong()
+        if (value < Int.MIN_VALUE || value > Int.MAX_VALUE) {
+            throw ValidationError("Value $value does not fit in Int")
+        }
+        return value.toInt()
+    }
+
+    /**
+     * Float value of either width as Double.
+     *
+     * @throws ValidationError if this node is not a float
+     */
+    fun asDouble(): Double = access { readDouble(it, type) }
+
+    /**
+     * Float value as Float.
+     *
+     * @throws ValidationError if this node is not a float
+     */
+    fun asFloat(): Float = asDouble().toFloat()
+
+    /**
+     * Bool value.
+     *
+     * @throws ValidationError if this node is not a bool
+     */
+    fun asBoolean(): Boolean = access { readBoolean(it, type) }
+
+    /**
+     * String value.
+     *
+     * @throws ValidationError if this node is not a string
+     */
+    fun asString(): String = access { readString(it, type) }
+
+    /**
+     * Convert this node's subtree to Kotlin values (as parse() would).
+     */
+    fun toKotlin(options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? =
+        access { gblnToKotlin(it, options) }
+
+    override fun toString(): String = "GblnNode(${GblnValueType.nameOf(type)})"
+
+    private fun expect(expected: Int) {
+        val actual = type
+        if (actual != expected) {
+            throw ValidationError(
+                "Expected ${GblnValueType.nameOf(expected)}, found ${GblnValueType.nameOf(actual)}"
+            )
+        }
+    }
+}
+
+/**
+ * Lazy view of this value's root (see GblnNode).
+ */
+fun ManagedGblnValue.node(): GblnNode = GblnNode(this, ptr)
@@ -0,0 +1,437 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import java.util.concurrent.Callable
+import java.util.concurrent.ForkJoinPool
+import java.util.concurrent.ForkJoinTask
+
+/**
+ * Inputs at least this large are parsed in parallel when
+ * GblnParseOptions.parallel is set. Override with
+ * -Dgbln.parallelThreshold=<bytes>.
+ */
+internal val parallelThreshold: Int =
+    System.getProperty("gbln.parallelThreshold")?.toIntOrNull() ?: (4 shl 20)
+
+/**
+ * Multi-core JVM-engine parse (GblnParseOptions.parallel).
+ *
+ * 1. The structural index is built in slices on the common ForkJoin pool.
+ * 2. SplitPlanner walks the index to find the innermost untyped array or
+ *    object spanning at least half the input (or the top-level members),
+ *    and split points between its elements.
+ * 3. Each chunk of elements is parsed and converted as a task, while the
+ *    calling thread parses the rest of the document with that container
+ *    left as a placeholder.
+ * 4. Chunk results are joined in order and put in place of the
+ *    placeholder.
+ *
+ * Chunks check for duplicate keys among their own members; the join
+ * checks across chunks. Any error, in a chunk or in the rest, makes the
+ * whole input be parsed again sequentially, so a failure reports exactly
+ * the code, message and position the sequential parser does.
+ */
+internal object ParallelParser {
+
+    private const val MIN_CHUNK = 256 * 1024
+
+    /** Tasks per pool thread, for load balance between uneven chunks. */
+    private const val CHUNKS_PER_THREAD = 4
+
+    /**
+     * @param threshold Smaller inputs are parsed sequentially
+     * @param minChunk Smallest chunk worth a task
+     * @throws GblnSyntaxException if the input is not valid GBLN
+     */
+    fun parse(
+        bytes: ByteArray,
+        offset: Int,
+        length: Int,
+        options: GblnParseOptions,
+        threshold: Int = parallelThreshold,
+        minChunk: Int = MIN_CHUNK
+    ): Any? {
+        val pool = ForkJoinPool.commonPool()
+        val parts = minOf(pool.parallelism * CHUNKS_PER_THREAD, length / minChunk)
+        val end = offset + length
+        if (length < threshold || parts < 2) {
+            return JvmParser.parse(bytes, offset, length).root.toKotlin(options)
+        }
+
+        val index = scan(pool, bytes, offset, end)
+        val plan = SplitPlanner(bytes, offset, end, index).plan(parts)
+        val value = plan?.let {
+            try {
+                execute(pool, bytes, offset, end, index, it, options)
+            } catch (e: GblnSyntaxException) {
+                null
+            }
+        }
+        return value ?: JvmParser(bytes, offset, end, index).parse().root.toKotlin(options)
+    }
+
+    private fun scan(pool: ForkJoinPool, bytes: ByteArray, from: Int, to: Int): StructuralIndex {
+        val slices = pool.parallelism
+        val slice = (to - from + slices - 1) / slices
+        val tasks = (0 until slices).map { i ->
+            val sliceFrom = minOf(to, from + i * slice)
+            val sliceTo = minOf(to, sliceFrom + slice)
+            pool.submit(Callable { structuralScanner.scan(bytes, sliceFrom, sliceTo) })
+        }
+        val parts = tasks.map { it.join() }
+        return StructuralIndex(parts.sumOf { it.size }).also { index -> parts.forEach { index.addAll(it) } }
+    }
+
+    /**
+     * Elements of one chunk, converted on a pool thread.
+     */
+    private class Chunk(
+        val doc: GblnDocument,
+        /** Converted elements, or null for a homogeneous primitive chunk converted at join. */
+        val values: Array<Any?>?,
+        /** Member keys (objects only). */
+        val keys: Array<String>?,
+        /** Shared element tag if every element is the same primitive scalar, else -1. */
+        val primitiveTag: Int
+    )
+
+    /**
+     * Parse and join; null if the chunks disagree (a duplicate key across
+     * chunks), leaving the error to the sequential parse.
+     */
+    private fun execute(
+        pool: ForkJoinPool,
+        bytes: ByteArray,
+        from: Int,
+        to: Int,
+        index: StructuralIndex,
+        plan: SplitPlan,
+        options: GblnParseOptions
+    ): Any? {
+        val splits = plan.splits
+        val tasks: List<ForkJoinTask<Chunk>> = (0 until splits.size - 1).map { i ->
+            pool.submit(Callable { chunk(bytes, splits[i], splits[i + 1], index, plan.array, options) })
+        }
+
+        val skeleton = if (plan.open >= 0) {
+            try {
+                JvmParser(bytes, from, to, index).let { parser -> parser.parseSkeleton(plan.open, plan.close) to parser.splicedNode }
+            } catch (e: GblnSyntaxException) {
+                tasks.forEach { it.cancel(false) }
+                throw e
+            }
+        } else {
+            null
+        }
+
+        val chunks = tasks.map { it.join() }
+        val joined = (if (plan.array) joinArray(chunks, options) else joinObject(chunks, options)) ?: return null
+
+        if (skeleton == null) {
+            return joined
+        }
+        val (doc, node) = skeleton
+        return doc.root.toKotlinReplacing(node, joined, options)
+    }
+
+    private fun chunk(
+        bytes: ByteArray,
+        from: Int,
+        to: Int,
+        index: StructuralIndex,
+        array: Boolean,
+        options: GblnParseOptions
+    ): Chunk {
+        val doc = JvmParser(bytes, from, to, index).parseRange(array)
+        val count = doc.words[0].toInt()
+
+        // Homogeneous scalar chunks are contiguous leaves; whether they
+        // become one primitive array depends on the other chunks
+        if (array && options.primitiveArrays && count > 0 && doc.ends[0] - 1 == count) {
+            val tag = doc.tags[1].toInt()
+            if (isPrimitiveArrayType(tag) && (2..count).all { doc.tags[it].toInt() == tag }) {
+                return Chunk(doc, null, null, tag)
+            }
+        }
+
+        val children = doc.root.children()
+        val values = arrayOfNulls<Any?>(count)
+        val keys = if (array) null else Array(count) { "" }
+        // One table per chunk: records of a chunk share their shapes
+        val shapes = if (options.compactObjects) ShapeTable() else null
+        children.forEachIndexed { i, child ->
+            values[i] = child.toKotlin(options, shapes)
+            if (keys != null) keys[i] = child.key!!
+        }
+        return Chunk(doc, values, keys, -1)
+    }
+
+    private fun joinArray(chunks: List<Chunk>, options: GblnParseOptions): Any? {
+        val tag = chunks[0].primitiveTag
+        if (tag >= 0 && chunks.all { it.primitiveTag == tag }) {
+            // Every element shares one primitive type: one primitive array,
+            // as the sequential conversion would produce
+            val parts = chunks.map { it.doc.root.toKotlin(options)!! }
+            val total = parts.sumOf { java.lang.reflect.Array.getLength(it) }
+            val result = java.lang.reflect.Array.newInstance(parts[0].javaClass.componentType, total)
+            var at = 0
+            for (part in parts) {
+                val n = java.lang.reflect.Array.getLength(part)
+                System.arraycopy(part, 0, result, at, n)
+                at += n
+            }
+            return result
+        }
+
+        val list = ArrayList<Any?>(chunks.sumOf { it.doc.words[0].toInt() })
+        for (chunk in chunks) {
+            val values = chunk.values
+            if (values != null) {
+                list.addAll(values)
+            } else {
+                chunk.doc.root.children().forEach { list.add(it.toKotlin(options)) }
+            }
+        }
+        return list
+    }
+
+    private fun joinObject(chunks: List<Chunk>, options: GblnParseOptions): Any? {
+        val total = chunks.sumOf { it.keys!!.size }
+        if (options.compactObjects) {
+            val seen = HashSet<String>(mapCapacity(total))
+            val shapes = ShapeTable()
+            var transition = shapes.root
+            val values = arrayOfNulls<Any?>(total)
+            var i = 0
+            for (chunk in chunks) {
+                chunk.keys!!.forEachIndexed { j, key ->
+                    if (!seen.add(key)) return null
+                    transition = transition.next(key)
+                    values[i++] = chunk.values!![j]
+                }
+            }
+            return shapes.build(transition, values)
+        }
+
+        val map = LinkedHashMap<String, Any?>(mapCapacity(total))
+        for (chunk in chunks) {
+            chunk.keys!!.forEachIndexed { j, key ->
+                val before = map.size
+                map[key] = chunk.values!![j]
+                if (map.size == before) return null
+            }
+        }
+        return map
+    }
+}
+
+/**
+ * Container chosen by SplitPlanner and the split points of its content.
+ *
+ * @property open Position of its opening delimiter; -1 for the top-level
+ *   members
+ * @property close Position of its closing delimiter
+ * @property array Untyped array (true) or object members (false)
+ * @property splits Chunk boundaries from content start to content end;
+ *   every inner boundary follows the end of an element
+ */
+internal class SplitPlan(val open: Int, val close: Int, val array: Boolean, val splits: IntArray)
+
+/**
+ * Finds where a document can be split, from its structural index alone.
+ *
+ * Tracks nesting through `{ [ ] }`, skips `(...)` payloads (honouring
+ * backslashes) and `:|` comments. Inside a typed array, `:|` in the middle
+ * of a bare element is not a comment, as in JvmParser. Valid input is
+ * classified exactly; for invalid input the plan may be wrong, but then a
+ * chunk fails and ParallelParser falls back to a sequential parse.
+ */
+internal class SplitPlanner(
+    private val input: ByteArray,
+    private val from: Int,
+    private val to: Int,
+    private val index: StructuralIndex
+) {
+    private val positions = index.positions
+
+    // Open containers: opening position and whether it is a typed array
+    private var opens = IntArray(32)
+    private var typed = BooleanArray(32)
+    private var depth = 0
+
+    /**
+     * Plan up to [parts] chunks, or null if the document has no container
+     * worth splitting.
+     */
+    fun plan(parts: Int): SplitPlan? {
+        val target = findTarget() ?: return null
+        val (open, close, array) = target
+        val contentStart = if (open >= 0) open + 1 else from
+        val contentEnd = if (open >= 0) close else to
+        val splits = split(contentStart, contentEnd, parts)
+        return if (splits.size > 2) SplitPlan(open, close, array, splits) else null
+    }
+
+    /**
+     * Innermost container spanning at least half the input, as (open,
+     * close, isArray); the top-level members if there is none.
+     */
+    private fun findTarget(): Triple<Int, Int, Boolean>? {
+        val half = (to - from) / 2
+        var best: Triple<Int, Int, Boolean>? = null
+        var bestDepth = -1
+        var bestTyped = false
+        depth = 0
+
+        var i = 0
+        var previous: Byte = 0
+        while (i < index.size) {
+            val p = positions[i]
+            val b = input[p]
+            when (b) {
+                LPAREN -> {
+                    i = payloadEnd(i)
+                    if (i < 0) return null
+                    previous = RPAREN
+                    i++
+                    continue
+                }
+                LBRACE, LBRACKET -> push(p, b == LBRACKET && previous == RANGLE)
+                RBRACE, RBRACKET -> {
+                    if (depth == 0) return null
+                    depth--
+                    val open = opens[depth]
+                    if (p - open >= half && depth > bestDepth) {
+                        best = Triple(open, p, b == RBRACKET)
+                        bestDepth = depth
+                        bestTyped = typed[depth]
+                    }
+                }
+                COLON -> if (isComment(p)) {
+                    i = commentEnd(i, p)
+                    continue
+                }
+            }
+            previous = b
+            i++
+        }
+
+        if (depth != 0 || bestTyped) {
+            return null
+        }
+        return best ?: Triple(-1, to, false)
+    }
+
+    /**
+     * Boundaries after elements of the content `[contentStart, contentEnd)`,
+     * near every (1 / parts)th of it.
+     */
+    private fun split(contentStart: Int, contentEnd: Int, parts: Int): IntArray {
+        val span = (contentEnd - contentStart).toLong()
+        fun target(k: Int): Int = contentStart + (span * k / parts).toInt()
+
+        val splits = ArrayList<Int>(parts + 1)
+        splits.add(contentStart)
+        var k = 1
+        var next = target(k)
+
+        depth = 0
+        var i = index.lowerBound(contentStart)
+        var previous: Byte = 0
+        while (i < index.size && k < parts) {
+            val p = positions[i]
+            if (p >= contentEnd) break
+            val b = input[p]
+            var elementEnd = -1
+            when (b) {
+                LPAREN -> {
+                    i = payloadEnd(i)
+                    if (i < 0) break
+                    if (depth == 0) elementEnd = positions[i] + 1
+                    previous = RPAREN
+                }
+                LBRACE, LBRACKET -> push(p, b == LBRACKET && previous == RANGLE)
+                RBRACE, RBRACKET -> {
+                    if (depth == 0) break
+                    depth--
+                    if (depth == 0) elementEnd = p + 1
+                }
+                COLON -> if (isComment(p)) {
+                    i = commentEnd(i, p)
+                    continue
+                }
+            }
+            if (b != LPAREN) previous = b
+            i++
+
+            if (elementEnd >= next && elementEnd < contentEnd) {
+                splits.add(elementEnd)
+                while (next <= elementEnd) next = target(++k)
+            }
+        }
+        splits.add(contentEnd)
+        return splits.toIntArray()
+    }
+
+    private fun push(position: Int, typedArray: Boolean) {
+        if (depth == opens.size) {
+            opens = opens.copyOf(depth * 2)
+            typed = typed.copyOf(depth * 2)
+        }
+        opens[depth] = position
+        typed[depth] = typedArray
+        depth++
+    }
+
+    /**
+     * Entry of the ')' closing the payload opened at entry [open], or -1.
+     */
+    private fun payloadEnd(open: Int): Int {
+        var skip = positions[open] + 1
+        var j = open + 1
+        while (j < index.size) {
+            val p = positions[j]
+            if (p >= skip) {
+                val b = input[p]
+                if (b == RPAREN) return j
+                if (b == BACKSLASH && p + 1 < to) skip = p + 2
+            }
+            j++
+        }
+        return -1
+    }
+
+    /**
+     * True if the ':' at [p] starts a comment: followed by '|' and, inside
+     * a typed array, at the start of an element.
+     */
+    private fun isComment(p: Int): Boolean {
+        if (p + 1 >= to || input[p + 1] != PIPE) return false
+        if (depth == 0 || !typed[depth - 1]) return true
+        val before = input[p - 1]
+        return GblnScalars.isWhitespace(before) || before == LBRACKET || before == RPAREN
+    }
+
+    /** First entry after the comment starting at [p] (entry [i]). */
+    private fun commentEnd(i: Int, p: Int): Int {
+        var newline = p
+        while (newline < to && input[newline] != NEWLINE) newline++
+        return index.seek(i, newline)
+    }
+
+    private companion object {
+        const val LBRACE = '{'.code.toByte()
+        const val RBRACE = '}'.code.toByte()
+        const val LBRACKET = '['.code.toByte()
+        const val RBRACKET = ']'.code.toByte()
+        const val LPAREN = '('.code.toByte()
+        const val RPAREN = ')'.code.toByte()
+        const val RANGLE = '>'.code.toByte()
+        const val COLON = ':'.code.toByte()
+        const val PIPE = '|'.code.toByte()
+        const val BACKSLASH = '\\'.code.toByte()
+        const val NEWLINE = '\n'.code.toByte()
+    }
+}
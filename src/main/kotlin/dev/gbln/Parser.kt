@@ -16,10 +16,14 @@
 
 package dev.gbln
 
+import com.sun.jna.Pointer
 import com.sun.jna.ptr.PointerByReference
+import java.nio.ByteBuffer
+import java.nio.channels.FileChannel
 import java.nio.file.Files
 import java.nio.file.Path
 import java.nio.file.Paths
+import java.nio.file.StandardOpenOption
 
 /**
  * GBLN parser API.
@@ -45,48 +49,443 @@ fun parseRaw(gblnString: String): ManagedGblnValue {
     // Call C function
     val errorCode = lib.gbln_parse(gblnString, valuePtr)
 
+    return wrapParsed(errorCode, valuePtr)
+}
+
+/**
+ * Parse UTF-8 encoded GBLN bytes to raw managed value (low-level API).
+ *
+ * Skips the String round trip: the bytes are copied once into a pooled
+ * native buffer and handed to the parser.
+ *
+ * @param bytes UTF-8 encoded GBLN input
+ * @param offset Index of the first input byte
+ * @param length Number of input bytes
+ * @return ManagedGblnValue with automatic memory cleanup
+ * @throws ParseError if parsing fails
+ * @throws IndexOutOfBoundsException if offset/length are outside bytes
+ */
+fun parseRaw(bytes: ByteArray, offset: Int = 0, length: Int = bytes.size - offset): ManagedGblnValue {
+    checkBounds(bytes, offset, length)
+
+    val valuePtr = PointerByReference()
+    val errorCode = NativeBuffers.withInput(bytes, offset, length) { lib.gbln_parse(it, valuePtr) }
+    return wrapParsed(errorCode, valuePtr)
+}
+
+/**
+ * Parse the remaining UTF-8 bytes of a buffer to raw managed value (low-level API).
+ *
+ * Heap buffers are copied once into a pooled native buffer. Direct buffers
+ * are passed through without copying when the byte at `limit()` is NUL
+ * (i.e. `limit() < capacity()` and the terminator was written there);
+ * otherwise they are copied once as well. The buffer's position and limit
+ * are not changed.
+ *
+ * @param buffer Buffer holding UTF-8 encoded GBLN between position and limit
+ * @return ManagedGblnValue with automatic memory cleanup
+ * @throws ParseError if parsing fails
+ */
+fun parseRaw(buffer: ByteBuffer): ManagedGblnValue {
+    val valuePtr = PointerByReference()
+    val errorCode = NativeBuffers.withInput(buffer) { lib.gbln_parse(it, valuePtr) }
+    return wrapParsed(errorCode, valuePtr)
+}
+
+/**
+ * Parse NUL-terminated UTF-8 in native memory to raw managed value (low-level API).
+ *
+ * Zero-copy: the parser reads the caller's memory directly. The memory
+ * must stay valid and unchanged for the duration of the call only.
+ *
+ * @param input Pointer to NUL-terminated UTF-8 GBLN input
+ * @return ManagedGblnValue with automatic memory cleanup
+ * @throws ParseError if parsing fails
+ */
+fun parseRaw(input: Pointer): ManagedGblnValue {
+    val valuePtr = PointerByReference()
+    val errorCode = lib.gbln_parse(input, valuePtr)
+    return wrapParsed(errorCode, valuePtr)
+}
+
+/**
+ * Check a gbln_parse result and take ownership of the parsed value.
+ */
+private fun wrapParsed(errorCode: Int, valuePtr: PointerByReference): ManagedGblnValue {
     // Check for errors
     if (errorCode != GblnErrorCode.OK) {
-        throw ParseError("Parse failed with error code: $errorCode")
+        throw ParseError(parseErrorMessage(errorCode), errorCode)
     }
 
     // Wrap in managed value for automatic cleanup
     return ManagedGblnValue(valuePtr.value)
 }
 
+/**
+ * Like wrapParsed(), but reports failure as a value.
+ */
+private fun parsedResult(errorCode: Int, valuePtr: PointerByReference): GblnParseResult<ManagedGblnValue> {
+    if (errorCode != GblnErrorCode.OK) {
+        return GblnParseResult.Failure(errorCode, parseErrorMessage(errorCode))
+    }
+    return GblnParseResult.Success(ManagedGblnValue(valuePtr.value))
+}
+
+/**
+ * Parser's message for the failed call, or a generic one.
+ */
+private fun parseErrorMessage(errorCode: Int): String =
+    lastErrorMessage() ?: "Parse failed with error code: $errorCode"
+
+internal fun checkBounds(bytes: ByteArray, offset: Int, length: Int) {
+    if (offset < 0 || length < 0 || offset > bytes.size - length) {
+        throw IndexOutOfBoundsException("offset $offset, length $length, size ${bytes.size}")
+    }
+}
+
+/**
+ * Parse GBLN string to raw managed value, reporting invalid input as a
+ * Failure instead of throwing.
+ *
+ * Rejection costs no exception and no stack trace, only the error code
+ * and the parser's message. Close the value of a Success as usual.
+ *
+ * @param gblnString GBLN-formatted string
+ * @return Success with the value, or Failure with code and message
+ */
+fun tryParseRaw(gblnString: String): GblnParseResult<ManagedGblnValue> {
+    val valuePtr = PointerByReference()
+    return parsedResult(lib.gbln_parse(gblnString, valuePtr), valuePtr)
+}
+
+/**
+ * Parse UTF-8 bytes to raw managed value without throwing on invalid input.
+ *
+ * @see tryParseRaw
+ * @throws IndexOutOfBoundsException if offset/length are outside bytes
+ */
+fun tryParseRaw(bytes: ByteArray, offset: Int = 0, length: Int = bytes.size - offset): GblnParseResult<ManagedGblnValue> {
+    checkBounds(bytes, offset, length)
+    val valuePtr = PointerByReference()
+    val errorCode = NativeBuffers.withInput(bytes, offset, length) { lib.gbln_parse(it, valuePtr) }
+    return parsedResult(errorCode, valuePtr)
+}
+
+/**
+ * Parse the remaining bytes of a buffer without throwing on invalid input.
+ *
+ * @see tryParseRaw
+ */
+fun tryParseRaw(buffer: ByteBuffer): GblnParseResult<ManagedGblnValue> {
+    val valuePtr = PointerByReference()
+    val errorCode = NativeBuffers.withInput(buffer) { lib.gbln_parse(it, valuePtr) }
+    return parsedResult(errorCode, valuePtr)
+}
+
+/**
+ * Parse GBLN string to Kotlin value, reporting invalid input as a Failure
+ * instead of throwing.
+ *
+ * Example:
+ * ```kotlin
+ * when (val result = tryParse(input)) {
+ *     is GblnParseResult.Success -> handle(result.value)
+ *     is GblnParseResult.Failure -> reject(result.code, result.message)
+ * }
+ * ```
+ *
+ * @param gblnString GBLN-formatted string
+ * @param options Result shape options
+ * @return Success with the converted value, or Failure with code and message
+ */
+fun tryParse(gblnString: String, options: GblnParseOptions = GblnParseOptions.DEFAULT): GblnParseResult<Any?> {
+    if (options.engine == GblnEngine.JVM) {
+        val bytes = gblnString.toByteArray(Charsets.UTF_8)
+        return jvmTryParse(bytes, 0, bytes.size, options)
+    }
+    return tryParseRaw(gblnString).map { raw -> raw.use { gblnToKotlin(it.ptr, options) } }
+}
+
+/**
+ * Parse UTF-8 bytes to Kotlin value without throwing on invalid input.
+ *
+ * @see tryParse
+ */
+fun tryParse(
+    bytes: ByteArray,
+    offset: Int = 0,
+    length: Int = bytes.size - offset,
+    options: GblnParseOptions = GblnParseOptions.DEFAULT
+): GblnParseResult<Any?> {
+    if (options.engine == GblnEngine.JVM) {
+        checkBounds(bytes, offset, length)
+        return jvmTryParse(bytes, offset, length, options)
+    }
+    return tryParseRaw(bytes, offset, length).map { raw -> raw.use { gblnToKotlin(it.ptr, options) } }
+}
+
+/**
+ * Parse the remaining bytes of a buffer to Kotlin value without throwing
+ * on invalid input.
+ *
+ * @see tryParse
+ */
+fun tryParse(buffer: ByteBuffer, options: GblnParseOptions = GblnParseOptions.DEFAULT): GblnParseResult<Any?> {
+    if (options.engine == GblnEngine.JVM) {
+        return withHeapBytes(buffer) { bytes, offset, length -> jvmTryParse(bytes, offset, length, options) }
+    }
+    return tryParseRaw(buffer).map { raw -> raw.use { gblnToKotlin(it.ptr, options) } }
+}
+
+/**
+ * Parse GBLN string to Kotlin value, or null if the input is invalid.
+ *
+ * @param gblnString GBLN-formatted string
+ * @param options Result shape options
+ * @return Kotlin Map, List, or primitive value; null on invalid input
+ */
+fun parseOrNull(gblnString: String, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? =
+    tryParse(gblnString, options).getOrNull()
+
+/**
+ * Parse UTF-8 bytes to Kotlin value, or null if the input is invalid.
+ */
+fun parseOrNull(
+    bytes: ByteArray,
+    offset: Int = 0,
+    length: Int = bytes.size - offset,
+    options: GblnParseOptions = GblnParseOptions.DEFAULT
+): Any? = tryParse(bytes, offset, length, options).getOrNull()
+
 /**
  * Parse GBLN string to Kotlin value.
  *
  * @param gblnString GBLN-formatted string
+ * @param options Result shape options
+ * @return Kotlin Map, List, or primitive value
+ * @throws ParseError if parsing fails
+ */
+fun parse(gblnString: String, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
+    if (options.engine == GblnEngine.JVM) {
+        val bytes = gblnString.toByteArray(Charsets.UTF_8)
+        return jvmParse(bytes, 0, bytes.size, options)
+    }
+    return parseRaw(gblnString).use { gblnToKotlin(it.ptr, options) }
+}
+
+/**
+ * Parse UTF-8 encoded GBLN bytes to Kotlin value.
+ *
+ * @param bytes UTF-8 encoded GBLN input
+ * @param offset Index of the first input byte
+ * @param length Number of input bytes
+ * @param options Result shape options
+ * @return Kotlin Map, List, or primitive value
+ * @throws ParseError if parsing fails
+ */
+fun parse(
+    bytes: ByteArray,
+    offset: Int = 0,
+    length: Int = bytes.size - offset,
+    options: GblnParseOptions = GblnParseOptions.DEFAULT
+): Any? {
+    if (options.engine == GblnEngine.JVM) {
+        checkBounds(bytes, offset, length)
+        return jvmParse(bytes, offset, length, options)
+    }
+    return parseRaw(bytes, offset, length).use { gblnToKotlin(it.ptr, options) }
+}
+
+/**
+ * Parse the remaining UTF-8 bytes of a buffer to Kotlin value.
+ *
+ * @param buffer Buffer holding UTF-8 encoded GBLN between position and limit
+ * @param options Result shape options
  * @return Kotlin Map, List, or primitive value
  * @throws ParseError if parsing fails
  */
-fun parse(gblnString: String): Any? {
-    val managedValue = parseRaw(gblnString)
-    return gblnToKotlin(managedValue.ptr)
+fun parse(buffer: ByteBuffer, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
+    if (options.engine == GblnEngine.JVM) {
+        return withHeapBytes(buffer) { bytes, offset, length -> jvmParse(bytes, offset, length, options) }
+    }
+    return parseRaw(buffer).use { gblnToKotlin(it.ptr, options) }
+}
+
+/**
+ * Parse GBLN string to Kotlin value, keeping only the members selected
+ * by [projection].
+ *
+ * Result shapes are those of parse(), limited to the projected keys; the
+ * other members are skipped without being built or checked (see
+ * GblnProjection). Always uses the JVM engine, whatever options.engine.
+ *
+ * Example:
+ * ```kotlin
+ * val user = parse(response, GblnProjection.of("user.id", "user.name")) as Map<*, *>
+ * ```
+ *
+ * @param gblnString GBLN-formatted string
+ * @param projection Keys to keep
+ * @param options Result shape options
+ * @return Kotlin Map or List
+ * @throws ParseError if parsing fails
+ */
+fun parse(
+    gblnString: String,
+    projection: GblnProjection,
+    options: GblnParseOptions = GblnParseOptions.DEFAULT
+): Any? {
+    val bytes = gblnString.toByteArray(Charsets.UTF_8)
+    return jvmParseProjected(bytes, 0, bytes.size, projection, options)
+}
+
+/**
+ * Parse UTF-8 encoded GBLN bytes to Kotlin value, keeping only the
+ * members selected by [projection].
+ *
+ * @see parse
+ * @throws ParseError if parsing fails
+ * @throws IndexOutOfBoundsException if the range lies outside [bytes]
+ */
+fun parse(
+    bytes: ByteArray,
+    offset: Int,
+    length: Int,
+    projection: GblnProjection,
+    options: GblnParseOptions = GblnParseOptions.DEFAULT
+): Any? {
+    checkBounds(bytes, offset, length)
+    return jvmParseProjected(bytes, offset, length, projection, options)
+}
+
+private fun jvmParseProjected(
+    bytes: ByteArray,
+    offset: Int,
+    length: Int,
+    projection: GblnProjection,
+    options: GblnParseOptions
+): Any? = try {
+    JvmParser.parse(bytes, offset, length, projection).root.toKotlin(options)
+} catch (e: GblnSyntaxException) {
+    throw e.toParseError()
+}
+
+/**
+ * Parse with the JVM engine, throwing ParseError as the native path does.
+ */
+private fun jvmParse(bytes: ByteArray, offset: Int, length: Int, options: GblnParseOptions): Any? = try {
+    jvmConvert(bytes, offset, length, options)
+} catch (e: GblnSyntaxException) {
+    throw e.toParseError()
+}
+
+private fun jvmTryParse(bytes: ByteArray, offset: Int, length: Int, options: GblnParseOptions): GblnParseResult<Any?> {
+    val value = try {
+        jvmConvert(bytes, offset, length, options)
+    } catch (e: GblnSyntaxException) {
+        return GblnParseResult.Failure(e.code, e.message!!)
+    }
+    return GblnParseResult.Success(value)
+}
+
+private fun jvmConvert(bytes: ByteArray, offset: Int, length: Int, options: GblnParseOptions): Any? =
+    if (options.parallel) {
+        ParallelParser.parse(bytes, offset, length, options)
+    } else {
+        JvmParser.parse(bytes, offset, length).root.toKotlin(options)
+    }
+
+/**
+ * Run [block] on the remaining bytes of [buffer] as a heap array, copying
+ * only if the buffer has no accessible backing array.
+ */
+private inline fun <T> withHeapBytes(buffer: ByteBuffer, block: (ByteArray, Int, Int) -> T): T {
+    if (buffer.hasArray()) {
+        return block(buffer.array(), buffer.arrayOffset() + buffer.position(), buffer.remaining())
+    }
+    val bytes = ByteArray(buffer.remaining())
+    buffer.duplicate().get(bytes)
+    return block(bytes, 0, bytes.size)
 }
 
 /**
  * Parse GBLN file to Kotlin value.
  *
  * @param filePath Path to .gbln file
+ * @param options Result shape options
  * @return Kotlin Map, List, or primitive value
  * @throws GblnError if parsing fails
  * @throws java.io.FileNotFoundException if file doesn't exist
  * @throws java.io.IOException if file cannot be read
  */
-fun parseFile(filePath: String): Any? = parseFile(Paths.get(filePath))
+fun parseFile(filePath: String, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? =
+    parseFile(Paths.get(filePath), options)
 
 /**
  * Parse GBLN file to Kotlin value.
  *
  * @param filePath Path to .gbln file
+ * @param options Result shape options
  * @return Kotlin Map, List, or primitive value
  * @throws GblnError if parsing fails
  * @throws java.io.FileNotFoundException if file doesn't exist
  * @throws java.io.IOException if file cannot be read
  */
-fun parseFile(filePath: Path): Any? {
+fun parseFile(filePath: Path, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
+    if (options.engine == GblnEngine.JVM) {
+        if (!Files.exists(filePath)) {
+            throw java.io.FileNotFoundException("File not found: $filePath")
+        }
+        val bytes = Files.readAllBytes(filePath)
+        return jvmParse(bytes, 0, bytes.size, options)
+    }
+    return parseFileRaw(filePath).use { gblnToKotlin(it.ptr, options) }
+}
+
+/**
+ * Parse GBLN file to Kotlin value, keeping only the members selected by
+ * [projection].
+ *
+ * @see parse
+ * @throws ParseError if parsing fails
+ * @throws java.io.FileNotFoundException if file doesn't exist
+ * @throws java.io.IOException if file cannot be read
+ */
+fun parseFile(
+    filePath: Path,
+    projection: GblnProjection,
+    options: GblnParseOptions = GblnParseOptions.DEFAULT
+): Any? {
+    if (!Files.exists(filePath)) {
+        throw java.io.FileNotFoundException("File not found: $filePath")
+    }
+    val bytes = Files.readAllBytes(filePath)
+    return jvmParseProjected(bytes, 0, bytes.size, projection, options)
+}
+
+/**
+ * Files at least this large are read by libgbln itself (gbln_parse_file);
+ * smaller ones are read into a pooled native buffer. Override with
+ * -Dgbln.nativeReadThreshold=<bytes>.
+ */
+internal val nativeReadThreshold: Long =
+    System.getProperty("gbln.nativeReadThreshold")?.toLongOrNull() ?: (1L shl 20)
+
+/**
+ * Parse GBLN file to raw managed value (low-level API).
+ *
+ * The file content goes to the native parser without passing through the
+ * JVM heap: files of at least `gbln.nativeReadThreshold` bytes (default
+ * 1 MiB) are opened and read by libgbln, smaller files are read once into
+ * a pooled native buffer.
+ *
+ * @param filePath Path to .gbln or uncompressed .io.gbln file
+ * @return ManagedGblnValue with automatic memory cleanup
+ * @throws ParseError if parsing fails
+ * @throws java.io.FileNotFoundException if file doesn't exist
+ * @throws java.io.IOException if file cannot be read
+ */
+fun parseFileRaw(filePath: Path): ManagedGblnValue {
     if (!Files.exists(filePath)) {
         throw java.io.FileNotFoundException("File not found: $filePath")
     }
@@ -95,11 +494,35 @@ fun parseFile(filePath: Path): Any? {
         throw java.io.IOException("Not a file: $filePath")
     }
 
-    val content = try {
-        Files.readString(filePath)
-    } catch (e: Exception) {
+    val valuePtr = PointerByReference()
+    if (Files.size(filePath) >= nativeReadThreshold) {
+        return wrapParsed(lib.gbln_parse_file(filePath.toString(), valuePtr), valuePtr)
+    }
+
+    val errorCode = try {
+        FileChannel.open(filePath, StandardOpenOption.READ).use { channel ->
+            val size = channel.size()
+            if (size > Int.MAX_VALUE - 1) {
+                throw java.io.IOException("File too large to parse in one piece: $filePath ($size bytes)")
+            }
+
+            val memory = NativeBuffers.acquire(size.toInt())
+            try {
+                val target = memory.getByteBuffer(0, size)
+                while (target.hasRemaining()) {
+                    if (channel.read(target) < 0) {
+                        throw java.io.IOException("File shrank while reading: $filePath")
+                    }
+                }
+                memory.setByte(size, 0)
+                lib.gbln_parse(memory, valuePtr)
+            } finally {
+                NativeBuffers.release(memory)
+            }
+        }
+    } catch (e: java.io.IOException) {
         throw java.io.IOException("Failed to read file $filePath: ${e.message}", e)
     }
 
-    return parse(content)
+    return wrapParsed(errorCode, valuePtr)
 }
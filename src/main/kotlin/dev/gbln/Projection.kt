@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+/**
+ * Keys to keep when parsing, for callers that read a few fields of a
+ * wide document.
+ *
+ * Built from key paths such as `user.id` or `config.database`. A path
+ * keeps the whole value at its end, and the objects on the way to it,
+ * limited to their projected keys. Paths apply through arrays:
+ * `users.name` keeps the name of every record in `users`. Scalars, and
+ * array elements that are not objects, are kept as they are.
+ *
+ * Members outside the projection are skipped by bracket matching: no
+ * values are built, no strings decoded and no ranges checked, so errors
+ * inside them (including duplicate keys) go unreported. Everything kept
+ * is parsed and checked as usual.
+ *
+ * Example:
+ * ```kotlin
+ * val projection = GblnProjection.of("user.id", "config.database")
+ * val data = parse(input, projection) as Map<*, *>
+ * ```
+ *
+ * Projections are immutable and can be shared between threads.
+ */
+class GblnProjection private constructor(
+    /** The paths this projection was built from. */
+    val paths: List<GblnPath>
+) {
+
+    /**
+     * Projected keys of one object level.
+     */
+    internal class Node {
+        /** A path ends here: keep the whole value. */
+        var keepAll = false
+            private set
+
+        // Few keys per level, so a linear scan over encoded keys
+        private var keys = emptyArray<ByteArray>()
+        private var children = emptyArray<Node>()
+
+        /** Node for the key in bytes[from until to], or null if not projected. */
+        fun child(bytes: ByteArray, from: Int, to: Int): Node? {
+            val length = to - from
+            for (i in keys.indices) {
+                val key = keys[i]
+                if (key.size == length && java.util.Arrays.equals(key, 0, length, bytes, from, to)) {
+                    return children[i]
+                }
+            }
+            return null
+        }
+
+        /** Node for [key], or null if not projected. */
+        fun child(key: String): Node? {
+            val bytes = key.toByteArray(Charsets.UTF_8)
+            return child(bytes, 0, bytes.size)
+        }
+
+        fun add(path: GblnPath) {
+            var node = this
+            for (step in path.steps) {
+                val key = requireNotNull(step.key) { "Projection paths cannot index arrays: \"$path\"" }
+                val bytes = key.toByteArray(Charsets.UTF_8)
+                node = node.child(bytes, 0, bytes.size) ?: Node().also {
+                    node.keys += bytes
+                    node.children += it
+                }
+            }
+            node.keepAll = true
+        }
+    }
+
+    internal val root = Node().also { root -> paths.forEach(root::add) }
+
+    override fun toString(): String = paths.joinToString(prefix = "GblnProjection(", postfix = ")")
+
+    companion object {
+        /**
+         * Projection keeping the given paths.
+         *
+         * @throws IllegalArgumentException if a path has an array index
+         */
+        fun of(paths: List<GblnPath>): GblnProjection = GblnProjection(paths.toList())
+
+        /**
+         * Projection keeping the given path expressions.
+         *
+         * @throws IllegalArgumentException if an expression is malformed or
+         *   has an array index
+         */
+        fun of(vararg expressions: String): GblnProjection = of(expressions.map(GblnPath::compile))
+    }
+}
@@ -0,0 +1,178 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import java.nio.ByteBuffer
+
+/**
+ * Receives the events of a GblnPushParser.
+ *
+ * Paths locate a value from the top-level object: keys as String, array
+ * indices as Int, e.g. `["users", 0, "name"]`. The top-level object
+ * itself has the empty path.
+ */
+interface GblnPushListener {
+
+    /**
+     * A scalar is complete: an object member such as `name<s64>(Alice)`
+     * or one element of a typed array. [value] is boxed as parse()
+     * returns it.
+     */
+    fun onValue(path: List<Any>, value: Any?)
+
+    fun onStartObject(path: List<Any>) {}
+
+    fun onEndObject(path: List<Any>) {}
+
+    fun onStartArray(path: List<Any>) {}
+
+    fun onEndArray(path: List<Any>) {}
+}
+
+/**
+ * Resumable parser for input that arrives in pieces, such as GBLN
+ * generated token by token.
+ *
+ * Each feed() parses as far as the bytes so far allow and reports every
+ * value as soon as its closing delimiter arrives; a token split across
+ * chunks is picked up again when the rest is fed. finish() marks the end
+ * of input and fails if the document is truncated.
+ *
+ * Example:
+ * ```kotlin
+ * val parser = GblnPushParser(object : GblnPushListener {
+ *     override fun onValue(path: List<Any>, value: Any?) = render(path, value)
+ * })
+ * stream.collect { chunk -> parser.feed(chunk) }
+ * parser.finish()
+ * ```
+ *
+ * Validation is the same as parse(): invalid input fails with ParseError
+ * from the feed() that completes the offending token, without waiting
+ * for the rest of the document. A split token is rescanned from its start
+ * when more input arrives; tokens are bounded by their type hints, so
+ * this stays cheap. Not thread safe.
+ */
+class GblnPushParser(private val listener: GblnPushListener) {
+
+    private val reader = GblnReader()
+
+    // Path of the current container, and the next index of each array
+    private val path = ArrayList<Any>()
+    private var indices = IntArray(16)
+    private var arrays = BooleanArray(16)
+
+    private var pendingKey: String? = null
+    private var failed = false
+    private var finished = false
+
+    /** True once the whole document has been parsed (after finish()). */
+    var isComplete: Boolean = false
+        private set
+
+    /**
+     * Parse the next chunk of UTF-8 input. Characters may be split
+     * across chunks.
+     *
+     * @throws ParseError if the input so far is not valid GBLN
+     * @throws IllegalStateException after finish() or a parse error
+     */
+    fun feed(bytes: ByteArray, offset: Int = 0, length: Int = bytes.size - offset) {
+        checkBounds(bytes, offset, length)
+        checkUsable()
+        reader.append(bytes, offset, length)
+        drain()
+    }
+
+    /**
+     * Parse the remaining bytes of [buffer].
+     */
+    fun feed(buffer: ByteBuffer) {
+        val bytes = ByteArray(buffer.remaining())
+        buffer.get(bytes)
+        feed(bytes)
+    }
+
+    /**
+     * Parse the next chunk of text.
+     */
+    fun feed(text: String) = feed(text.toByteArray(Charsets.UTF_8))
+
+    /**
+     * End of input: parse what is left and check the document is
+     * complete.
+     *
+     * @throws ParseError if the document is truncated or invalid
+     *   (e.g. ERROR_UNEXPECTED_EOF for an unclosed object)
+     */
+    fun finish() {
+        checkUsable()
+        finished = true
+        reader.endOfInput()
+        drain()
+        isComplete = true
+    }
+
+    private fun checkUsable() {
+        check(!failed) { "GblnPushParser failed on invalid input" }
+        check(!finished) { "GblnPushParser has finished" }
+    }
+
+    private fun drain() {
+        try {
+            while (true) {
+                val token = reader.nextOrNull() ?: return
+                if (!dispatch(token)) return
+            }
+        } catch (e: ParseError) {
+            failed = true
+            throw e
+        }
+    }
+
+    /**
+     * Report [token]; false at the end of the document.
+     */
+    private fun dispatch(token: GblnToken): Boolean {
+        when (token) {
+            GblnToken.KEY -> pendingKey = reader.key
+            GblnToken.VALUE -> {
+                enter(reader.depth - 1)
+                listener.onValue(snapshot(), reader.getValue())
+                path.removeAt(path.size - 1)
+            }
+            GblnToken.START_OBJECT, GblnToken.START_ARRAY -> {
+                // reader.depth includes the new container; frames are 0-based
+                val frame = reader.depth - 1
+                if (frame > 0) enter(frame - 1)
+                if (frame == indices.size) {
+                    indices = indices.copyOf(frame * 2)
+                    arrays = arrays.copyOf(frame * 2)
+                }
+                val array = token == GblnToken.START_ARRAY
+                indices[frame] = 0
+                arrays[frame] = array
+                if (array) listener.onStartArray(snapshot()) else listener.onStartObject(snapshot())
+            }
+            GblnToken.END_OBJECT, GblnToken.END_ARRAY -> {
+                if (token == GblnToken.END_ARRAY) listener.onEndArray(snapshot()) else listener.onEndObject(snapshot())
+                if (reader.depth > 0) path.removeAt(path.size - 1)
+            }
+            GblnToken.END_DOCUMENT -> return false
+        }
+        return true
+    }
+
+    /** Extend the path with the key or next index of container [frame]. */
+    private fun enter(frame: Int) {
+        if (arrays[frame]) {
+            path.add(indices[frame]++)
+        } else {
+            path.add(pendingKey!!)
+            pendingKey = null
+        }
+    }
+
+    private fun snapshot(): List<Any> = path.toList()
+}
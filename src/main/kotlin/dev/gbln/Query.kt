@@ -0,0 +1,329 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Memory
+import com.sun.jna.Pointer
+import java.lang.ref.Reference
+
+/**
+ * Compiled path to a value inside a document, e.g. `config.database.port`
+ * or `users[0].name`.
+ *
+ * Compiling parses the expression once. Each key is encoded as
+ * NUL-terminated UTF-8 in native memory on its first native lookup, so
+ * later lookups pass a ready pointer to gbln_object_get instead of
+ * marshalling a String; paths only used on the JVM side (projections)
+ * never touch JNA. Paths are immutable and can be shared between threads
+ * and queries.
+ *
+ * Syntax: keys separated by `.`, array indices in brackets (`[3]`).
+ */
+class GblnPath private constructor(
+    /** The expression this path was compiled from. */
+    val expression: String,
+    internal val steps: List<Step>
+) {
+
+    /**
+     * One navigation step: an object key or an array index.
+     */
+    internal class Step(val key: String?, val index: Int) {
+        /** Key encoded on first use; null for index steps. */
+        val nativeKey: Memory? by lazy {
+            key?.let {
+                val bytes = it.toByteArray(Charsets.UTF_8)
+                Memory(bytes.size + 1L).apply {
+                    write(0, bytes, 0, bytes.size)
+                    setByte(bytes.size.toLong(), 0)
+                }
+            }
+        }
+
+        fun sameAs(other: Step): Boolean = key == other.key && index == other.index
+
+        override fun toString(): String = key ?: "[$index]"
+    }
+
+    override fun toString(): String = expression
+
+    override fun equals(other: Any?): Boolean = other is GblnPath && other.expression == expression
+
+    override fun hashCode(): Int = expression.hashCode()
+
+    companion object {
+        /**
+         * Compile a path expression.
+         *
+         * @throws IllegalArgumentException if the expression is malformed
+         */
+        fun compile(expression: String): GblnPath {
+            val steps = ArrayList<Step>()
+            var i = 0
+            val n = expression.length
+            var expectKey = true
+
+            while (i < n) {
+                when (expression[i]) {
+                    '[' -> {
+                        val close = expression.indexOf(']', i)
+                        require(close > i + 1) { "Unterminated or empty index at $i in \"$expression\"" }
+                        val index = expression.substring(i + 1, close).toIntOrNull()
+                        require(index != null && index >= 0) { "Invalid index at $i in \"$expression\"" }
+                        steps.add(Step(null, index))
+                        i = close + 1
+                        expectKey = false
+                    }
+                    '.' -> {
+                        require(!expectKey && i + 1 < n) { "Empty key at $i in \"$expression\"" }
+                        i++
+                        expectKey = true
+                    }
+                    else -> {
+                        require(expectKey) { "Expected '.' or '[' at $i in \"$expression\"" }
+                        var end = i
+                        while (end < n && expression[end] != '.' && expression[end] != '[') end++
+                        steps.add(Step(expression.substring(i, end), -1))
+                        i = end
+                        expectKey = false
+                    }
+                }
+            }
+
+            require(steps.isNotEmpty()) { "Empty path" }
+            return GblnPath(expression, steps)
+        }
+    }
+}
+
+/**
+ * Batch extraction of compiled paths.
+ *
+ * The paths are merged into a tree so shared prefixes (`config.database`
+ * in `config.database.host` and `config.database.port`) are resolved
+ * once, and [execute] walks it in a single pass over the value. Scalars
+ * are read straight into primitive arrays without boxing; only objects
+ * and arrays found at a path are converted to Kotlin values.
+ *
+ * Example:
+ * ```kotlin
+ * val query = GblnQuery.of("user.id", "config.database.port")
+ * parseRaw(input).use { value ->
+ *     val result = query.execute(value)
+ *     val id = result.getLong(0)
+ *     val port = result.getLong(1)
+ * }
+ * ```
+ */
+class GblnQuery private constructor(
+    /** Paths in result order. */
+    val paths: List<GblnPath>,
+    private val options: GblnParseOptions
+) {
+
+    /**
+     * Node of the merged path tree; [targets] are result slots ending here.
+     */
+    private class Node(val step: GblnPath.Step?) {
+        val children = ArrayList<Node>()
+        var targets = IntArray(0)
+    }
+
+    private val root = Node(null).also { root ->
+        paths.forEachIndexed { slot, path ->
+            var node = root
+            for (step in path.steps) {
+                node = node.children.firstOrNull { it.step!!.sameAs(step) }
+                    ?: Node(step).also { node.children.add(it) }
+            }
+            node.targets += slot
+        }
+    }
+
+    /**
+     * Extract every path from [value].
+     *
+     * @throws IllegalStateException if the value has been closed
+     */
+    fun execute(value: ManagedGblnValue): GblnQueryResult {
+        val result = GblnQueryResult(paths)
+        try {
+            visitChildren(root, value.ptr, result)
+        } finally {
+            Reference.reachabilityFence(value)
+        }
+        return result
+    }
+
+    private fun visitChildren(node: Node, ptr: Pointer, result: GblnQueryResult) {
+        if (node.children.isEmpty()) {
+            return
+        }
+
+        val type = lib.gbln_value_type(ptr)
+        for (child in node.children) {
+            val step = child.step!!
+            val childPtr: Pointer? = if (step.key != null) {
+                if (type == GblnValueType.OBJECT) lib.gbln_object_get(ptr, step.nativeKey!!) else null
+            } else if (type == GblnValueType.ARRAY && step.index < lib.gbln_array_len(ptr)) {
+                lib.gbln_array_get(ptr, step.index.toLong())
+            } else {
+                null
+            }
+
+            if (childPtr != null && Pointer.nativeValue(childPtr) != 0L) {
+                visit(child, childPtr, result)
+            }
+        }
+    }
+
+    private fun visit(node: Node, ptr: Pointer, result: GblnQueryResult) {
+        if (node.targets.isNotEmpty()) {
+            val type = lib.gbln_value_type(ptr)
+            for (slot in node.targets) {
+                result.store(slot, type, ptr, options)
+            }
+        }
+        visitChildren(node, ptr, result)
+    }
+
+    companion object {
+        /**
+         * Query for the given paths, in result order.
+         *
+         * @param options Conversion options for objects and arrays found at a path
+         */
+        fun of(paths: List<GblnPath>, options: GblnParseOptions = GblnParseOptions.DEFAULT): GblnQuery =
+            GblnQuery(paths.toList(), options)
+
+        /**
+         * Query for the given path expressions, in result order.
+         *
+         * @throws IllegalArgumentException if an expression is malformed
+         */
+        fun of(vararg expressions: String): GblnQuery = of(expressions.map { GblnPath.compile(it) })
+    }
+}
+
+/**
+ * Values extracted by GblnQuery.execute(), one slot per path.
+ *
+ * Scalars are held unboxed. The result owns no native memory and stays
+ * valid after the parsed value is closed.
+ */
+class GblnQueryResult internal constructor(private val paths: List<GblnPath>) {
+
+    private val types = IntArray(paths.size) { MISSING }
+    private val longs = LongArray(paths.size)
+    private val doubles = DoubleArray(paths.size)
+    private var objects: Array<Any?>? = null
+
+    /** Number of slots (paths in the query). */
+    val size: Int get() = types.size
+
+    internal fun store(slot: Int, type: Int, ptr: Pointer, options: GblnParseOptions) {
+        types[slot] = type
+        when (type) {
+            in GblnValueType.I8..GblnValueType.U64 -> longs[slot] = readLong(ptr, type)
+            GblnValueType.F32, GblnValueType.F64 -> doubles[slot] = readDouble(ptr, type)
+            GblnValueType.BOOL -> longs[slot] = if (readBoolean(ptr, type)) 1 else 0
+            GblnValueType.NULL -> {}
+            GblnValueType.STRING -> slots()[slot] = readString(ptr, type)
+            else -> slots()[slot] = walkToKotlin(ptr, options)
+        }
+    }
+
+    private fun slots(): Array<Any?> = objects ?: arrayOfNulls<Any?>(types.size).also { objects = it }
+
+    /** True if the path at [slot] exists in the document. */
+    fun isPresent(slot: Int): Boolean = types[slot] != MISSING
+
+    /** Value type at [slot] (see GblnValueType), or -1 if absent. */
+    fun type(slot: Int): Int = types[slot]
+
+    /**
+     * Integer at [slot] as Long (u64 keeps its bit pattern).
+     *
+     * @throws ValidationError if absent or not an integer
+     */
+    fun getLong(slot: Int): Long {
+        val type = present(slot)
+        if (type !in GblnValueType.I8..GblnValueType.U64) {
+            throw mismatch(slot, "integer")
+        }
+        return longs[slot]
+    }
+
+    /**
+     * Integer at [slot] as Long, or [default] if absent.
+     *
+     * @throws ValidationError if present but not an integer
+     */
+    fun getLongOrDefault(slot: Int, default: Long): Long = if (isPresent(slot)) getLong(slot) else default
+
+    /**
+     * Float at [slot] as Double.
+     *
+     * @throws ValidationError if absent or not a float
+     */
+    fun getDouble(slot: Int): Double {
+        val type = present(slot)
+        if (type != GblnValueType.F32 && type != GblnValueType.F64) {
+            throw mismatch(slot, "float")
+        }
+        return doubles[slot]
+    }
+
+    /**
+     * Bool at [slot].
+     *
+     * @throws ValidationError if absent or not a bool
+     */
+    fun getBoolean(slot: Int): Boolean {
+        if (present(slot) != GblnValueType.BOOL) {
+            throw mismatch(slot, "bool")
+        }
+        return longs[slot] != 0L
+    }
+
+    /**
+     * String at [slot].
+     *
+     * @throws ValidationError if absent or not a string
+     */
+    fun getString(slot: Int): String {
+        if (present(slot) != GblnValueType.STRING) {
+            throw mismatch(slot, "string")
+        }
+        return objects!![slot] as String
+    }
+
+    /**
+     * Value at [slot] as parse() would return it, or null if absent.
+     */
+    operator fun get(slot: Int): Any? = when (val type = types[slot]) {
+        MISSING, GblnValueType.NULL -> null
+        GblnValueType.I8, GblnValueType.I16, GblnValueType.I32, GblnValueType.U8, GblnValueType.U16 -> longs[slot].toInt()
+        GblnValueType.I64, GblnValueType.U32, GblnValueType.U64 -> longs[slot]
+        GblnValueType.F32 -> doubles[slot].toFloat()
+        GblnValueType.F64 -> doubles[slot]
+        GblnValueType.BOOL -> longs[slot] != 0L
+        else -> objects!![slot]
+    }
+
+    private fun present(slot: Int): Int {
+        val type = types[slot]
+        if (type == MISSING) {
+            throw ValidationError("Path not found: ${paths[slot]}")
+        }
+        return type
+    }
+
+    private fun mismatch(slot: Int, expected: String) =
+        ValidationError("Expected $expected at ${paths[slot]}, found ${GblnValueType.nameOf(types[slot])}")
+
+    private companion object {
+        const val MISSING = -1
+    }
+}
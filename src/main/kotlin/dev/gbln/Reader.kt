@@ -0,0 +1,838 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import java.io.Closeable
+import java.io.InputStream
+import java.nio.ByteBuffer
+import java.nio.channels.FileChannel
+import java.nio.channels.ReadableByteChannel
+import java.nio.file.Files
+import java.nio.file.Path
+import java.nio.file.StandardOpenOption
+
+/**
+ * Event returned by GblnReader.next().
+ */
+enum class GblnToken {
+    START_OBJECT,
+    END_OBJECT,
+    START_ARRAY,
+    END_ARRAY,
+
+    /** An object member's key; the member's value follows. */
+    KEY,
+
+    /** A scalar (single value or typed array element). */
+    VALUE,
+
+    END_DOCUMENT
+}
+
+/**
+ * Pull parser over a byte stream.
+ *
+ * Reads GBLN incrementally and reports it as a sequence of GblnToken
+ * events, so documents of any size can be processed without holding
+ * them, or a tree built from them, in memory. Memory use is one read
+ * buffer, one scalar payload and a frame per open container, plus the
+ * keys of each open object (needed to reject duplicate keys).
+ *
+ * Like parse(), a document of top-level members is reported as one
+ * object: it starts with START_OBJECT and ends with END_OBJECT.
+ *
+ * Example, summing a field over a large array of records:
+ * ```kotlin
+ * GblnReader.open(path).use { reader ->
+ *     var total = 0L
+ *     while (reader.next() != GblnToken.END_DOCUMENT) {
+ *         if (reader.token == GblnToken.KEY && reader.key == "amount") {
+ *             reader.next()
+ *             total += reader.getLong()
+ *         }
+ *     }
+ * }
+ * ```
+ *
+ * Accepts the same language as parse() and fails with ParseError carrying
+ * the same GblnErrorCode values. Keys and non-string payloads are only
+ * bounded by the input; a string payload beyond what its sN hint allows
+ * is skipped rather than buffered. Not thread safe.
+ */
+class GblnReader private constructor(
+    // Null in push mode (GblnPushParser), where input arrives via append()
+    private val source: Source?,
+    bufferSize: Int
+) : Closeable {
+
+    /** Push mode: bytes are supplied with append() and endOfInput(). */
+    internal constructor() : this(null, DEFAULT_BUFFER_SIZE)
+
+    /**
+     * Read GBLN from [input]. The stream is closed with the reader.
+     *
+     * @param bufferSize Read buffer size in bytes
+     */
+    constructor(input: InputStream, bufferSize: Int = DEFAULT_BUFFER_SIZE) : this(
+        object : Source {
+            override fun read(buffer: ByteArray, offset: Int, length: Int) = input.read(buffer, offset, length)
+            override fun close() = input.close()
+        },
+        bufferSize
+    )
+
+    /**
+     * Read GBLN from a blocking [channel]. The channel is closed with the
+     * reader.
+     *
+     * @param bufferSize Read buffer size in bytes
+     */
+    constructor(channel: ReadableByteChannel, bufferSize: Int = DEFAULT_BUFFER_SIZE) : this(
+        object : Source {
+            override fun read(buffer: ByteArray, offset: Int, length: Int) =
+                channel.read(ByteBuffer.wrap(buffer, offset, length))
+
+            override fun close() = channel.close()
+        },
+        bufferSize
+    )
+
+    private interface Source : Closeable {
+        fun read(buffer: ByteArray, offset: Int, length: Int): Int
+    }
+
+    init {
+        require(bufferSize >= MIN_BUFFER_SIZE) { "bufferSize must be >= $MIN_BUFFER_SIZE, got $bufferSize" }
+    }
+
+    // Input window; buffer[bufPos until bufEnd] is unread
+    private var buffer = ByteArray(bufferSize)
+    private var bufPos = 0
+    private var bufEnd = 0
+    private var eof = false
+
+    // Stream offset of buffer[0], and line tracking for error messages
+    private var bufStart = 0L
+    private var line = 1
+    private var lineStart = 0L
+    private var markLine = 1
+    private var markColumn = 1
+
+    // Current payload (raw) and its unescaped copy
+    private var scratch = ByteArray(64)
+    private var unescaped = ByteArray(64)
+
+    // Open containers, innermost last
+    private var kinds = ByteArray(16)
+    private var hints = IntArray(16)
+    private var keySets = arrayOfNulls<HashSet<String>>(16)
+
+    private var started = false
+    private var afterKey = false
+    private var skipping = false
+    private var closed = false
+
+    private var longValue = 0L
+    private var doubleValue = 0.0
+    private var stringValue: String? = null
+
+    /** The last token returned by next(), or null before the first call. */
+    var token: GblnToken? = null
+        private set
+
+    /**
+     * Key of the current object member: set by KEY and kept for the
+     * member's value (VALUE, START_OBJECT or START_ARRAY). Null for array
+     * elements and end tokens.
+     */
+    var key: String? = null
+        private set
+
+    /**
+     * Value type (see GblnValueType) of the current VALUE, START_OBJECT or
+     * START_ARRAY token; -1 otherwise.
+     */
+    var type: Int = -1
+        private set
+
+    /**
+     * Element type of the typed array just started (`tags<s16>[...]`);
+     * -1 for untyped arrays and other tokens.
+     */
+    var elementType: Int = -1
+        private set
+
+    /** Number of open containers, including the top-level object. */
+    var depth: Int = 0
+        private set
+
+    /**
+     * Advance to the next token.
+     *
+     * @throws ParseError if the input is not valid GBLN
+     * @throws java.io.IOException if reading fails
+     * @throws IllegalStateException if the reader has been closed
+     */
+    fun next(): GblnToken {
+        check(!closed) { "GblnReader has been closed" }
+        stringValue = null
+        elementType = -1
+        val next = if (afterKey) {
+            afterKey = false
+            memberValue()
+        } else {
+            advance()
+        }
+        token = next
+        return next
+    }
+
+    /**
+     * Skip the current value: after KEY the member's value, after
+     * START_OBJECT or START_ARRAY the rest of that container. The next
+     * call to next() returns the token that follows it. Skipped content
+     * is still checked, but strings are not decoded.
+     */
+    fun skipValue() {
+        skipping = true
+        try {
+            when (token) {
+                GblnToken.KEY -> {
+                    val next = next()
+                    if (next == GblnToken.START_OBJECT || next == GblnToken.START_ARRAY) skipContainer()
+                }
+                GblnToken.START_OBJECT, GblnToken.START_ARRAY -> skipContainer()
+                else -> {}
+            }
+        } finally {
+            skipping = false
+        }
+    }
+
+    private fun skipContainer() {
+        val target = depth - 1
+        while (depth > target) {
+            next()
+        }
+    }
+
+    /**
+     * Read the current value as parse() would return it: after VALUE the
+     * scalar, after START_OBJECT or START_ARRAY the rest of that container
+     * as a Map or List, after KEY the member's value.
+     */
+    fun readValue(): Any? = when (token) {
+        GblnToken.KEY -> {
+            next()
+            readValue()
+        }
+        GblnToken.VALUE -> getValue()
+        GblnToken.START_OBJECT -> {
+            val map = LinkedHashMap<String, Any?>()
+            while (next() != GblnToken.END_OBJECT) {
+                val name = key!!
+                next()
+                map[name] = readValue()
+            }
+            map
+        }
+        GblnToken.START_ARRAY -> {
+            val list = ArrayList<Any?>()
+            while (next() != GblnToken.END_ARRAY) {
+                list.add(readValue())
+            }
+            list
+        }
+        else -> throw IllegalStateException("No value at $token")
+    }
+
+    // Typed accessors
+
+    /** True if the current VALUE is null (`<n>()`). */
+    val isNull: Boolean get() = token == GblnToken.VALUE && type == GblnValueType.NULL
+
+    /**
+     * Integer value as Long (u64 keeps its bit pattern).
+     *
+     * @throws ValidationError if the current token is not an integer
+     */
+    fun getLong(): Long {
+        if (type !in GblnValueType.I8..GblnValueType.U64) throw mismatch("integer")
+        return longValue
+    }
+
+    /**
+     * Integer value as Int.
+     *
+     * @throws ValidationError if not an integer or out of Int range
+     */
+    fun getInt(): Int {
+        val value = getLong()
+        if (value < Int.MIN_VALUE || value > Int.MAX_VALUE || (type == GblnValueType.U64 && value < 0)) {
+            throw ValidationError("Value of type ${GblnValueType.nameOf(type)} does not fit Int")
+        }
+        return value.toInt()
+    }
+
+    /**
+     * Float value as Double.
+     *
+     * @throws ValidationError if the current token is not a float
+     */
+    fun getDouble(): Double {
+        if (type != GblnValueType.F32 && type != GblnValueType.F64) throw mismatch("float")
+        return doubleValue
+    }
+
+    /** Float value as Float. */
+    fun getFloat(): Float = getDouble().toFloat()
+
+    /**
+     * Bool value.
+     *
+     * @throws ValidationError if the current token is not a bool
+     */
+    fun getBoolean(): Boolean {
+        if (type != GblnValueType.BOOL) throw mismatch("bool")
+        return longValue != 0L
+    }
+
+    /**
+     * String value.
+     *
+     * @throws ValidationError if the current token is not a string
+     */
+    fun getString(): String {
+        if (type != GblnValueType.STRING || token != GblnToken.VALUE) throw mismatch("string")
+        return stringValue ?: throw IllegalStateException("String was skipped")
+    }
+
+    /**
+     * Current VALUE boxed as parse() returns it (Int, Long, Float,
+     * Double, Boolean, String or null).
+     */
+    fun getValue(): Any? {
+        check(token == GblnToken.VALUE) { "No scalar at $token" }
+        return when (type) {
+            GblnValueType.I8, GblnValueType.I16, GblnValueType.I32, GblnValueType.U8, GblnValueType.U16 -> longValue.toInt()
+            GblnValueType.I64, GblnValueType.U32, GblnValueType.U64 -> longValue
+            GblnValueType.F32 -> doubleValue.toFloat()
+            GblnValueType.F64 -> doubleValue
+            GblnValueType.BOOL -> longValue != 0L
+            GblnValueType.STRING -> getString()
+            else -> null
+        }
+    }
+
+    private fun mismatch(expected: String) = ValidationError(
+        "Expected $expected, found " +
+            if (token == GblnToken.VALUE) GblnValueType.nameOf(type) else token.toString()
+    )
+
+    /**
+     * Close the reader and its source. Idempotent.
+     */
+    override fun close() {
+        if (!closed) {
+            closed = true
+            source?.close()
+        }
+    }
+
+    // Structure
+
+    private fun advance(): GblnToken {
+        if (depth == 0) {
+            return if (!started) startDocument() else endDocument()
+        }
+
+        skipWhitespace()
+        val b = peek()
+        key = null
+        type = -1
+        return when (kinds[depth - 1]) {
+            TOP, OBJECT -> member(b)
+            ARRAY -> element(b)
+            else -> typedElement(b)
+        }
+    }
+
+    private fun startDocument(): GblnToken {
+        started = true
+        skipWhitespace()
+        if (peek() == LBRACE) {
+            bufPos++
+            push(OBJECT, 0)
+        } else {
+            push(TOP, 0)
+        }
+        type = GblnValueType.OBJECT
+        return GblnToken.START_OBJECT
+    }
+
+    private fun endDocument(): GblnToken {
+        if (token != GblnToken.END_DOCUMENT) {
+            skipWhitespace()
+            if (peek() >= 0) fail(GblnErrorCode.ERROR_UNEXPECTED_TOKEN, "Unexpected content after document")
+        }
+        key = null
+        type = -1
+        return GblnToken.END_DOCUMENT
+    }
+
+    private fun member(b: Int): GblnToken {
+        val topLevel = kinds[depth - 1] == TOP
+        if (b < 0) {
+            if (topLevel) return pop(GblnToken.END_OBJECT)
+            fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected '}'")
+        }
+        if (b == RBRACE.toInt()) {
+            if (topLevel) fail(GblnErrorCode.ERROR_UNEXPECTED_TOKEN, "Unexpected '}'")
+            bufPos++
+            return pop(GblnToken.END_OBJECT)
+        }
+
+        val name = readKey()
+        val keys = keySets[depth - 1] ?: HashSet<String>().also { keySets[depth - 1] = it }
+        if (!keys.add(name)) {
+            failAtMark(GblnErrorCode.ERROR_DUPLICATE_KEY, "Duplicate key: $name")
+        }
+        key = name
+        afterKey = true
+        return GblnToken.KEY
+    }
+
+    private fun memberValue(): GblnToken {
+        skipWhitespace()
+        return when (peek()) {
+            -1 -> fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input after key")
+            LANGLE.toInt() -> typed()
+            LBRACE.toInt() -> {
+                bufPos++
+                push(OBJECT, 0)
+                type = GblnValueType.OBJECT
+                GblnToken.START_OBJECT
+            }
+            LBRACKET.toInt() -> {
+                bufPos++
+                push(ARRAY, 0)
+                type = GblnValueType.ARRAY
+                GblnToken.START_ARRAY
+            }
+            else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected '<', '{' or '[', found ${describe()}")
+        }
+    }
+
+    private fun element(b: Int): GblnToken = when (b) {
+        -1 -> fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected ']'")
+        RBRACKET.toInt() -> {
+            bufPos++
+            pop(GblnToken.END_ARRAY)
+        }
+        LBRACE.toInt() -> {
+            bufPos++
+            push(OBJECT, 0)
+            type = GblnValueType.OBJECT
+            GblnToken.START_OBJECT
+        }
+        LBRACKET.toInt() -> {
+            bufPos++
+            push(ARRAY, 0)
+            type = GblnValueType.ARRAY
+            GblnToken.START_ARRAY
+        }
+        LANGLE.toInt() -> typed()
+        else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected array element, found ${describe()}")
+    }
+
+    private fun typedElement(b: Int): GblnToken {
+        val hint = hints[depth - 1]
+        return when (b) {
+            -1 -> fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input, expected ']'")
+            RBRACKET.toInt() -> {
+                bufPos++
+                pop(GblnToken.END_ARRAY)
+            }
+            LPAREN.toInt() -> readParenthesised(hint)
+            else -> readBare(hint)
+        }
+    }
+
+    /**
+     * `<hint>(value)` or `<hint>[values]`, at '<'.
+     */
+    private fun typed(): GblnToken {
+        val hint = readHint()
+        skipWhitespace()
+        return when (peek()) {
+            -1 -> fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unexpected end of input after type hint")
+            LPAREN.toInt() -> readParenthesised(hint)
+            LBRACKET.toInt() -> {
+                bufPos++
+                push(TYPED_ARRAY, hint)
+                type = GblnValueType.ARRAY
+                elementType = hint and 0xFF
+                GblnToken.START_ARRAY
+            }
+            else -> fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected '(' or '[', found ${describe()}")
+        }
+    }
+
+    private fun push(kind: Byte, hint: Int) {
+        if (depth == kinds.size) {
+            kinds = kinds.copyOf(depth * 2)
+            hints = hints.copyOf(depth * 2)
+            keySets = keySets.copyOf(depth * 2)
+        }
+        kinds[depth] = kind
+        hints[depth] = hint
+        keySets[depth]?.clear()
+        depth++
+    }
+
+    private fun pop(end: GblnToken): GblnToken {
+        depth--
+        return end
+    }
+
+    // Tokens
+
+    private fun readKey(): String {
+        mark()
+        var n = 0
+        while (true) {
+            if (bufPos == bufEnd && !fill()) break
+            val b = buffer[bufPos]
+            if (!isKeyByte(b)) break
+            store(n++, b)
+            bufPos++
+        }
+        if (n == 0) {
+            fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Expected key, found ${describe()}")
+        }
+        return KeyInterner.intern(scratch, 0, n)
+    }
+
+    /**
+     * Parse `<hint>`, at '<'; returns the value type with the sN bound
+     * above bit 8.
+     */
+    private fun readHint(): Int {
+        mark()
+        bufPos++
+        var n = 0
+        while (true) {
+            if (bufPos == bufEnd && !fill()) {
+                fail(GblnErrorCode.ERROR_UNEXPECTED_EOF, "Unterminated type hint")
+            }
+            val b = buffer[bufPos]
+            if (b == RANGLE) break
+            if (isBracket(b) || GblnScalars.isWhitespace(b)) {
+                fail(GblnErrorCode.ERROR_INVALID_TYPE_HINT, "Unterminated type hint")
+            }
+            if (n < MAX_HINT_BYTES) store(n, b)
+            n++
+            bufPos++
+        }
+        bufPos++
+        if (n > MAX_HINT_BYTES) {
+            failAtMark(GblnErrorCode.ERROR_INVALID_TYPE_HINT, "Invalid type hint")
+        }
+        return try {
+            GblnScalars.hint(scratch, 0, n)
+        } catch (e: GblnSyntaxException) {
+            failAtMark(e.code, e.message!!)
+        }
+    }
+
+    /**
+     * `(payload)`, at '('.
+     */
+    private fun readParenthesised(hint: Int): GblnToken {
+        mark()
+        bufPos++
+        val limit = payloadLimit(hint)
+        var n = 0
+        var escaped = false
+        while (true) {
+            if (bufPos == bufEnd && !fill()) {
+                failAtMark(GblnErrorCode.ERROR_UNTERMINATED_STRING, "Missing ')'")
+            }
+            var b = buffer[bufPos]
+            if (b == RPAREN) {
+                bufPos++
+                break
+            }
+            if (b == BACKSLASH && ensure(2)) {
+                escaped = true
+                if (n < limit) store(n, b)
+                n++
+                bufPos++
+                b = buffer[bufPos]
+            }
+            if (n < limit) store(n, b)
+            n++
+            bufPos++
+            if (b == NEWLINE) newline()
+        }
+        return decode(hint, n, limit, escaped)
+    }
+
+    /**
+     * Bare element of a typed array, up to whitespace or ']'.
+     */
+    private fun readBare(hint: Int): GblnToken {
+        mark()
+        val limit = payloadLimit(hint)
+        var n = 0
+        while (true) {
+            if (bufPos == bufEnd && !fill()) break
+            val b = buffer[bufPos]
+            if (GblnScalars.isWhitespace(b) || b == RBRACKET) break
+            if (isBracket(b)) {
+                fail(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Unexpected ${describe()} in array")
+            }
+            if (n < limit) store(n, b)
+            n++
+            bufPos++
+        }
+        return decode(hint, n, limit, escaped = false)
+    }
+
+    private fun payloadLimit(hint: Int): Int =
+        if (hint and 0xFF == GblnValueType.STRING) (hint ushr 8) * 8 else Int.MAX_VALUE
+
+    private fun decode(hint: Int, length: Int, limit: Int, escaped: Boolean): GblnToken {
+        val valueType = hint and 0xFF
+        if (length > limit) {
+            failAtMark(GblnErrorCode.ERROR_STRING_TOO_LONG, "String exceeds s${hint ushr 8}")
+        }
+
+        try {
+            when (valueType) {
+                GblnValueType.STRING -> {
+                    var bytes = scratch
+                    var n = length
+                    if (escaped) {
+                        if (unescaped.size < n) unescaped = ByteArray(maxOf(n, unescaped.size * 2))
+                        n = GblnScalars.unescape(scratch, 0, length, unescaped)
+                        bytes = unescaped
+                    }
+                    GblnScalars.checkLength(hint ushr 8, bytes, 0, n)
+                    if (!skipping) stringValue = String(bytes, 0, n, Charsets.UTF_8)
+                }
+                GblnValueType.BOOL -> longValue = if (GblnScalars.parseBoolean(scratch, 0, length)) 1 else 0
+                GblnValueType.NULL -> GblnScalars.checkNull(scratch, 0, length)
+                GblnValueType.F32 -> doubleValue = GblnScalars.parseFloat(scratch, 0, length).toDouble()
+                GblnValueType.F64 -> doubleValue = GblnScalars.parseDouble(scratch, 0, length)
+                else -> longValue = GblnScalars.parseInteger(valueType, scratch, 0, length)
+            }
+        } catch (e: GblnSyntaxException) {
+            failAtMark(e.code, e.message!!)
+        }
+        type = valueType
+        return GblnToken.VALUE
+    }
+
+    private fun store(index: Int, b: Byte) {
+        if (index == scratch.size) {
+            scratch = scratch.copyOf(index * 2)
+        }
+        scratch[index] = b
+    }
+
+    // Input
+
+    /** Next byte (0-255) without consuming it, or -1 at end of input. */
+    private fun peek(): Int {
+        if (bufPos == bufEnd && !fill()) return -1
+        return buffer[bufPos].toInt() and 0xFF
+    }
+
+    /**
+     * Make at least [count] bytes available at bufPos; false if the input
+     * ends first.
+     */
+    private fun ensure(count: Int): Boolean {
+        while (bufEnd - bufPos < count) {
+            if (!fill()) return false
+        }
+        return true
+    }
+
+    /**
+     * Move the unread bytes to the front of the buffer and read more
+     * behind them; false at end of input.
+     */
+    private fun fill(): Boolean {
+        if (eof) return false
+        if (source == null) throw NeedInput
+        val remaining = bufEnd - bufPos
+        if (bufPos > 0) {
+            System.arraycopy(buffer, bufPos, buffer, 0, remaining)
+            bufStart += bufPos
+            bufPos = 0
+            bufEnd = remaining
+        }
+        while (true) {
+            val n = source.read(buffer, bufEnd, buffer.size - bufEnd)
+            if (n < 0) {
+                eof = true
+                return false
+            }
+            if (n > 0) {
+                bufEnd += n
+                return true
+            }
+        }
+    }
+
+    private fun skipWhitespace() {
+        while (true) {
+            if (bufPos == bufEnd && !fill()) return
+            val b = buffer[bufPos]
+            if (b == NEWLINE) {
+                bufPos++
+                newline()
+            } else if (GblnScalars.isWhitespace(b)) {
+                bufPos++
+            } else if (b == COLON && ensure(2) && buffer[bufPos + 1] == PIPE) {
+                while ((bufPos < bufEnd || fill()) && buffer[bufPos] != NEWLINE) bufPos++
+            } else {
+                return
+            }
+        }
+    }
+
+    private fun isBracket(b: Byte): Boolean = StructuralScanner.isBracket(b)
+
+    private fun isKeyByte(b: Byte): Boolean = !GblnScalars.isWhitespace(b) && !isBracket(b) && b != COLON
+
+    // Errors
+
+    /** Record a newline just consumed (at bufPos - 1). */
+    private fun newline() {
+        line++
+        lineStart = bufStart + bufPos
+    }
+
+    private fun column(): Int = (bufStart + bufPos - lineStart + 1).toInt()
+
+    /** Remember the current position for errors reported after a token. */
+    private fun mark() {
+        markLine = line
+        markColumn = column()
+    }
+
+    private fun describe(): String =
+        if (peek() < 0) "end of input" else "'${String(buffer, bufPos, 1, Charsets.ISO_8859_1)}'"
+
+    private fun fail(code: Int, message: String): Nothing =
+        throw ParseError("$message at line $line, column ${column()}", code)
+
+    private fun failAtMark(code: Int, message: String): Nothing =
+        throw ParseError("$message at line $markLine, column $markColumn", code)
+
+    // Push mode
+
+    /**
+     * Thrown by fill() in push mode when a token runs past the bytes
+     * appended so far.
+     */
+    private object NeedInput : RuntimeException(null, null, false, false)
+
+    /**
+     * Add input in push mode. Only called between tokens, so everything
+     * before bufPos has been consumed and can be dropped.
+     */
+    internal fun append(bytes: ByteArray, offset: Int, length: Int) {
+        check(!eof) { "Input already ended" }
+        val remaining = bufEnd - bufPos
+        if (remaining + length > buffer.size) {
+            val grown = ByteArray(maxOf(remaining + length, buffer.size * 2))
+            System.arraycopy(buffer, bufPos, grown, 0, remaining)
+            buffer = grown
+        } else if (bufPos > 0) {
+            System.arraycopy(buffer, bufPos, buffer, 0, remaining)
+        }
+        bufStart += bufPos
+        bufPos = 0
+        bufEnd = remaining
+        System.arraycopy(bytes, offset, buffer, bufEnd, length)
+        bufEnd += length
+    }
+
+    /** Mark the end of input in push mode. */
+    internal fun endOfInput() {
+        eof = true
+    }
+
+    /**
+     * next() for push mode: null if the appended input ends inside the
+     * next token, with the reader rewound to before it so the same call
+     * can be repeated after append().
+     */
+    internal fun nextOrNull(): GblnToken? {
+        val savedPos = bufPos
+        val savedLine = line
+        val savedLineStart = lineStart
+        val savedAfterKey = afterKey
+        val savedStarted = started
+        val savedKey = key
+        val savedType = type
+        return try {
+            next()
+        } catch (e: NeedInput) {
+            bufPos = savedPos
+            line = savedLine
+            lineStart = savedLineStart
+            afterKey = savedAfterKey
+            started = savedStarted
+            key = savedKey
+            type = savedType
+            null
+        }
+    }
+
+    companion object {
+        /** Default read buffer size. */
+        const val DEFAULT_BUFFER_SIZE = 64 * 1024
+
+        private const val MIN_BUFFER_SIZE = 16
+
+        /** Longest valid hint (`s1024`) is five bytes; anything longer is rejected. */
+        private const val MAX_HINT_BYTES = 8
+
+        // Container kinds
+        private const val TOP: Byte = 0
+        private const val OBJECT: Byte = 1
+        private const val ARRAY: Byte = 2
+        private const val TYPED_ARRAY: Byte = 3
+
+        private const val LBRACE = '{'.code.toByte()
+        private const val RBRACE = '}'.code.toByte()
+        private const val LBRACKET = '['.code.toByte()
+        private const val RBRACKET = ']'.code.toByte()
+        private const val LPAREN = '('.code.toByte()
+        private const val RPAREN = ')'.code.toByte()
+        private const val LANGLE = '<'.code.toByte()
+        private const val RANGLE = '>'.code.toByte()
+        private const val COLON = ':'.code.toByte()
+        private const val PIPE = '|'.code.toByte()
+        private const val BACKSLASH = '\\'.code.toByte()
+        private const val NEWLINE = '\n'.code.toByte()
+
+        /**
+         * Reader over a file.
+         *
+         * @throws java.io.FileNotFoundException if the file doesn't exist
+         */
+        fun open(path: Path, bufferSize: Int = DEFAULT_BUFFER_SIZE): GblnReader {
+            if (!Files.exists(path)) {
+                throw java.io.FileNotFoundException("File not found: $path")
+            }
+            return GblnReader(FileChannel.open(path, StandardOpenOption.READ), bufferSize)
+        }
+    }
+}
@@ -0,0 +1,281 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import java.io.Closeable
+import java.io.InputStream
+import java.nio.ByteBuffer
+import java.nio.channels.Channels
+import java.nio.channels.FileChannel
+import java.nio.channels.ReadableByteChannel
+import java.nio.file.Files
+import java.nio.file.Path
+import java.nio.file.StandardOpenOption
+import java.util.concurrent.Callable
+import java.util.concurrent.ForkJoinPool
+import java.util.concurrent.ForkJoinTask
+
+/**
+ * Iterator over newline-delimited GBLN records.
+ *
+ * Each line of the input is one document, converted as parse() would
+ * convert it; lines holding only whitespace are skipped. A record cannot
+ * span lines, so string payloads must not contain raw newlines.
+ *
+ * The input is read in batches of whole lines, and each batch is parsed
+ * on [pool] while the caller consumes earlier ones. Records are returned
+ * in input order. At most [lookAhead] batches are read ahead of the
+ * caller, which bounds memory however slow the caller is. Workers keep
+ * their parser buffers between records, and batch buffers are recycled.
+ * The calling thread only reads and finds the last newline of each batch.
+ *
+ * Example:
+ * ```kotlin
+ * GblnRecordStream.open(Path.of("events.gbln")).use { records ->
+ *     for (record in records) {
+ *         ingest(record as Map<*, *>)
+ *     }
+ * }
+ * ```
+ *
+ * Always parses with the JVM engine; options.engine and options.parallel
+ * are ignored. A record that fails to parse makes next() throw
+ * ParseError, with the line in its message; iteration can continue with
+ * the following record. Not thread safe.
+ *
+ * @param channel Blocking channel to read; closed with the stream
+ * @param options Conversion options for every record
+ * @param pool Pool that parses batches. Default: the common pool
+ * @param lookAhead Most batches read ahead of the caller. Default: twice
+ *   the pool's parallelism
+ * @param batchSize Bytes per batch (grown for longer lines). Default: 256 KiB
+ */
+class GblnRecordStream(
+    private val channel: ReadableByteChannel,
+    private val options: GblnParseOptions = GblnParseOptions.DEFAULT,
+    private val pool: ForkJoinPool = ForkJoinPool.commonPool(),
+    private val lookAhead: Int = 2 * pool.parallelism,
+    private val batchSize: Int = DEFAULT_BATCH_SIZE
+) : Iterator<Any?>, Closeable {
+
+    /**
+     * Read records from [input]. The stream is closed with the record
+     * stream.
+     */
+    constructor(
+        input: InputStream,
+        options: GblnParseOptions = GblnParseOptions.DEFAULT,
+        pool: ForkJoinPool = ForkJoinPool.commonPool(),
+        lookAhead: Int = 2 * pool.parallelism,
+        batchSize: Int = DEFAULT_BATCH_SIZE
+    ) : this(Channels.newChannel(input), options, pool, lookAhead, batchSize)
+
+    init {
+        require(lookAhead >= 1) { "lookAhead must be >= 1, got $lookAhead" }
+        require(batchSize >= MIN_BATCH_SIZE) { "batchSize must be >= $MIN_BATCH_SIZE, got $batchSize" }
+    }
+
+    private class Batch(val bytes: ByteArray, val task: ForkJoinTask<Decoded>)
+
+    /** Records of a batch, and the number of lines it spans. */
+    private class Decoded(val records: Array<Any?>, val lines: Int)
+
+    /**
+     * A record that failed to parse, at line [line] of its batch (from 0).
+     * Reparsed when next() reaches it, to report its line in the input.
+     */
+    private class Failure(val start: Int, val end: Int, val line: Int)
+
+    private val inFlight = ArrayDeque<Batch>()
+    private val free = ArrayDeque<ByteArray>()
+
+    // Batch being consumed
+    private var current: Batch? = null
+    private var records: Array<Any?> = emptyArray()
+    private var position = 0
+
+    // Start of an incomplete last line, carried into the next batch
+    private var carry = ByteArray(0)
+    private var carryLength = 0
+
+    // Input line of the current batch's first line
+    private var firstLine = 1L
+    private var lines = 0
+    private var eof = false
+    private var closed = false
+
+    /**
+     * @throws java.io.IOException if reading fails
+     */
+    override fun hasNext(): Boolean {
+        check(!closed) { "Record stream is closed" }
+        while (position == records.size) {
+            current?.let { free.addLast(it.bytes) }
+            current = null
+            records = emptyArray()
+            position = 0
+            firstLine += lines
+            lines = 0
+
+            fill()
+            val batch = inFlight.removeFirstOrNull() ?: return false
+            val decoded = batch.task.join()
+            current = batch
+            records = decoded.records
+            lines = decoded.lines
+        }
+        return true
+    }
+
+    /**
+     * The next record.
+     *
+     * @throws ParseError if the record is not valid GBLN
+     * @throws NoSuchElementException if there are no more records
+     * @throws java.io.IOException if reading fails
+     */
+    override fun next(): Any? {
+        if (!hasNext()) throw NoSuchElementException()
+        val record = records[position]
+        records[position++] = null
+        if (record is Failure) {
+            try {
+                JvmParser(current!!.bytes, record.start, record.end, firstLine = firstLine + record.line).parse()
+            } catch (e: GblnSyntaxException) {
+                throw e.toParseError()
+            }
+            throw IllegalStateException("Record at line ${firstLine + record.line} failed once but parsed again")
+        }
+        return record
+    }
+
+    /**
+     * Close the stream and its channel, cancelling batches not yet
+     * parsed. Idempotent.
+     */
+    override fun close() {
+        if (!closed) {
+            closed = true
+            inFlight.forEach { it.task.cancel(false) }
+            inFlight.clear()
+            records = emptyArray()
+            channel.close()
+        }
+    }
+
+    /** Read and submit batches until lookAhead are in flight. */
+    private fun fill() {
+        while (inFlight.size < lookAhead) {
+            val bytes = free.removeFirstOrNull() ?: ByteArray(batchSize)
+            val (buffer, length) = readBatch(bytes) ?: run {
+                free.addLast(bytes)
+                return
+            }
+            inFlight.addLast(Batch(buffer, pool.submit(Callable { decode(buffer, length, options) })))
+        }
+    }
+
+    /**
+     * Fill [bytes] with the carried bytes and then whole lines from the
+     * channel, growing it if one line doesn't fit.
+     *
+     * @return the filled buffer and its length, or null at end of input
+     */
+    private fun readBatch(bytes: ByteArray): Pair<ByteArray, Int>? {
+        var buffer = if (bytes.size > carryLength) bytes else ByteArray(carryLength * 2)
+        System.arraycopy(carry, 0, buffer, 0, carryLength)
+        var length = carryLength
+        var scanned = carryLength
+        var cut = -1
+
+        while (cut < 0) {
+            if (eof) {
+                if (length == 0) return null
+                cut = length
+                break
+            }
+            if (length == buffer.size) {
+                cut = lastNewline(buffer, scanned, length)
+                if (cut >= 0) break
+                scanned = length
+                buffer = buffer.copyOf(buffer.size * 2)
+            }
+            val n = channel.read(ByteBuffer.wrap(buffer, length, buffer.size - length))
+            if (n < 0) eof = true else length += n
+        }
+
+        carryLength = length - cut
+        if (carry.size < carryLength) {
+            carry = ByteArray(buffer.size)
+        }
+        System.arraycopy(buffer, cut, carry, 0, carryLength)
+        return Pair(buffer, cut)
+    }
+
+    companion object {
+        /** Default batch size. */
+        const val DEFAULT_BATCH_SIZE = 256 * 1024
+
+        private const val MIN_BATCH_SIZE = 16
+
+        private const val NEWLINE = '\n'.code.toByte()
+
+        // Parser storage of each worker thread, reused across records
+        private val tapes = ThreadLocal.withInitial { TapeBuilder() }
+
+        /**
+         * Record stream over a file.
+         *
+         * @throws java.io.FileNotFoundException if the file doesn't exist
+         */
+        fun open(
+            path: Path,
+            options: GblnParseOptions = GblnParseOptions.DEFAULT,
+            pool: ForkJoinPool = ForkJoinPool.commonPool(),
+            lookAhead: Int = 2 * pool.parallelism,
+            batchSize: Int = DEFAULT_BATCH_SIZE
+        ): GblnRecordStream {
+            if (!Files.exists(path)) {
+                throw java.io.FileNotFoundException("File not found: $path")
+            }
+            return GblnRecordStream(FileChannel.open(path, StandardOpenOption.READ), options, pool, lookAhead, batchSize)
+        }
+
+        /** Position after the last newline in bytes[from until to], or -1. */
+        private fun lastNewline(bytes: ByteArray, from: Int, to: Int): Int {
+            for (i in to - 1 downTo from) {
+                if (bytes[i] == NEWLINE) return i + 1
+            }
+            return -1
+        }
+
+        /** Parse the non-blank lines of bytes[0 until length], on a worker. */
+        private fun decode(bytes: ByteArray, length: Int, options: GblnParseOptions): Decoded {
+            val tape = tapes.get()
+            val results = ArrayList<Any?>()
+            var line = 0
+            var lineStart = 0
+            while (lineStart < length) {
+                var lineEnd = lineStart
+                var blank = true
+                while (lineEnd < length && bytes[lineEnd] != NEWLINE) {
+                    if (blank && !GblnScalars.isWhitespace(bytes[lineEnd])) blank = false
+                    lineEnd++
+                }
+                if (!blank) {
+                    tape.reset()
+                    results += try {
+                        // The tape is reused for the next line, so convert without copying it
+                        JvmParser(bytes, lineStart, lineEnd, tape = tape).parse(shared = true).root.toKotlin(options)
+                    } catch (e: GblnSyntaxException) {
+                        Failure(lineStart, lineEnd, line)
+                    }
+                }
+                line++
+                lineStart = lineEnd + 1
+            }
+            return Decoded(results.toTypedArray(), line)
+        }
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+/**
+ * Outcome of the non-throwing parse functions (tryParse, tryParseRaw).
+ *
+ * Invalid input is an expected result here, not an exception: a Failure
+ * holds just the parser's error code and message.
+ */
+sealed class GblnParseResult<out T> {
+
+    /**
+     * Input parsed successfully.
+     */
+    class Success<out T>(val value: T) : GblnParseResult<T>() {
+        override fun toString(): String = "Success($value)"
+    }
+
+    /**
+     * Input rejected by the parser.
+     *
+     * @property code Error code (see GblnErrorCode)
+     * @property message Parser's description of the problem
+     */
+    class Failure(val code: Int, val message: String) : GblnParseResult<Nothing>() {
+        /** The ParseError parse() would have thrown. */
+        fun toException(): ParseError = ParseError(message, code)
+
+        override fun toString(): String = "Failure($code, $message)"
+    }
+
+    val isSuccess: Boolean get() = this is Success
+
+    /**
+     * The value, or null on failure.
+     */
+    fun getOrNull(): T? = (this as? Success)?.value
+
+    /**
+     * The value.
+     *
+     * @throws ParseError on failure
+     */
+    fun getOrThrow(): T = when (this) {
+        is Success -> value
+        is Failure -> throw toException()
+    }
+
+    /**
+     * Transform the value of a Success; a Failure is passed through.
+     */
+    inline fun <R> map(transform: (T) -> R): GblnParseResult<R> = when (this) {
+        is Success -> Success(transform(value))
+        is Failure -> this
+    }
+}
@@ -0,0 +1,264 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+/**
+ * Type hint and scalar decoding shared by the JVM parsers (JvmParser,
+ * GblnReader).
+ *
+ * Functions work on a byte range and throw GblnSyntaxException without a
+ * location; callers add the line and column of the range.
+ */
+internal object GblnScalars {
+
+    private const val MINUS = '-'.code.toByte()
+    private const val PLUS = '+'.code.toByte()
+    private const val ZERO = '0'.code.toByte()
+    private const val DOT = '.'.code.toByte()
+    private const val BACKSLASH = '\\'.code.toByte()
+
+    /** Largest magnitude that can take another digit: (2^64 - 1) / 10. */
+    private const val MAX_BEFORE_DIGIT = 1844674407370955161L
+
+    private val STRING_BOUNDS = setOf(2, 4, 8, 16, 32, 64, 128, 256, 512, 1024)
+
+    /** Digit counts that cannot overflow an unsigned 64-bit magnitude. */
+    private const val MAX_UNCHECKED_DIGITS = 19
+
+    /** Exponents are clamped here; anything larger is 0 or infinity anyway. */
+    private const val MAX_EXPONENT = 99_999
+
+    // Largest magnitude (unsigned) per integer type and sign: index
+    // type * 2 for positive values, type * 2 + 1 for negative ones
+    private val LIMITS = longArrayOf(
+        Byte.MAX_VALUE.toLong(), Byte.MAX_VALUE + 1L,
+        Short.MAX_VALUE.toLong(), Short.MAX_VALUE + 1L,
+        Int.MAX_VALUE.toLong(), Int.MAX_VALUE + 1L,
+        Long.MAX_VALUE, Long.MIN_VALUE,
+        0xFF, 0,
+        0xFFFF, 0,
+        0xFFFFFFFFL, 0,
+        -1L, 0
+    )
+
+    /** Largest possible string payload in UTF-8 bytes (s1024, 4-byte characters). */
+    const val MAX_STRING_BYTES = 1024 * 4
+
+    /**
+     * Decode the hint between `<` and `>`: the value type, with the sN
+     * bound above bit 8 for strings.
+     *
+     * @throws GblnSyntaxException with ERROR_INVALID_TYPE_HINT
+     */
+    fun hint(bytes: ByteArray, from: Int, to: Int): Int {
+        val hint = String(bytes, from, to - from, Charsets.ISO_8859_1)
+        return when (hint) {
+            "i8" -> GblnValueType.I8
+            "i16" -> GblnValueType.I16
+            "i32" -> GblnValueType.I32
+            "i64" -> GblnValueType.I64
+            "u8" -> GblnValueType.U8
+            "u16" -> GblnValueType.U16
+            "u32" -> GblnValueType.U32
+            "u64" -> GblnValueType.U64
+            "f32" -> GblnValueType.F32
+            "f64" -> GblnValueType.F64
+            "b" -> GblnValueType.BOOL
+            "n" -> GblnValueType.NULL
+            else -> {
+                val bound = if (hint.startsWith("s")) hint.substring(1).toIntOrNull() else null
+                if (bound == null || bound !in STRING_BOUNDS) {
+                    throw GblnSyntaxException(GblnErrorCode.ERROR_INVALID_TYPE_HINT, "Invalid type hint: <$hint>")
+                }
+                GblnValueType.STRING or (bound shl 8)
+            }
+        }
+    }
+
+    /**
+     * Parse a decimal integer and check it fits [type]. Unsigned 64-bit
+     * values keep their bit pattern.
+     */
+    fun parseInteger(type: Int, bytes: ByteArray, from: Int, to: Int): Long {
+        var i = from
+        var last = to
+        while (i < last && isWhitespace(bytes[i])) i++
+        while (last > i && isWhitespace(bytes[last - 1])) last--
+
+        val negative = i < last && bytes[i] == MINUS
+        if (negative || (i < last && bytes[i] == PLUS)) i++
+        if (i == last) mismatch(GblnValueType.nameOf(type))
+
+        // Short enough not to overflow: eight digits at a time, then one
+        // by one, stopping at the first non-digit
+        var magnitude = 0L
+        if (last - i <= MAX_UNCHECKED_DIGITS) {
+            while (last - i >= 8) {
+                val eight = DecimalKernels.eightDigits(bytes, i)
+                if (eight < 0) break
+                magnitude = magnitude * 100_000_000 + eight
+                i += 8
+            }
+            while (i < last) {
+                val digit = bytes[i] - ZERO
+                if (digit < 0 || digit > 9) break
+                magnitude = magnitude * 10 + digit
+                i++
+            }
+        }
+
+        // Whatever is left (a long or invalid number): accumulate as
+        // unsigned, failing on any 64-bit overflow
+        while (i < last) {
+            val digit = bytes[i] - ZERO
+            if (digit < 0 || digit > 9) mismatch(GblnValueType.nameOf(type))
+            if (java.lang.Long.compareUnsigned(magnitude, MAX_BEFORE_DIGIT) > 0) outOfRange(type)
+            val next = magnitude * 10 + digit
+            if (java.lang.Long.compareUnsigned(next, magnitude * 10) < 0) outOfRange(type)
+            magnitude = next
+            i++
+        }
+
+        // One unsigned compare covers the type's range for either sign
+        val limit = LIMITS[(type shl 1) or (if (negative) 1 else 0)]
+        if (java.lang.Long.compareUnsigned(magnitude, limit) > 0) outOfRange(type)
+        return if (negative) -magnitude else magnitude
+    }
+
+    /** Parse an f64 payload, correctly rounded. */
+    fun parseDouble(bytes: ByteArray, from: Int, to: Int): Double =
+        Double.fromBits(parseDecimal(DecimalKernels.DOUBLE, bytes, from, to))
+
+    /** Parse an f32 payload, correctly rounded (not via a double). */
+    fun parseFloat(bytes: ByteArray, from: Int, to: Int): Float =
+        Float.fromBits(parseDecimal(DecimalKernels.FLOAT, bytes, from, to).toInt())
+
+    /**
+     * Check `[+-]?(digits[.digits?]|.digits)([eE][+-]?digits)?` and
+     * convert it to the bits of [format]. Up to 19 significant digits go
+     * through DecimalKernels; longer mantissas, and the rare values the
+     * kernel cannot decide, through the JDK's exact conversion.
+     */
+    private fun parseDecimal(format: DecimalKernels.Format, bytes: ByteArray, from: Int, to: Int): Long {
+        var i = from
+        var last = to
+        while (i < last && isWhitespace(bytes[i])) i++
+        while (last > i && isWhitespace(bytes[last - 1])) last--
+        val start = i
+
+        val negative = i < last && bytes[i] == MINUS
+        if (negative || (i < last && bytes[i] == PLUS)) i++
+
+        // Mantissa digits as w * 10^q; past 19 significant digits w is
+        // incomplete and the JDK converts the text instead
+        var w = 0L
+        var q = 0
+        var significant = 0
+        var digits = 0
+        while (i < last && isDigit(bytes[i])) {
+            if (significant < MAX_UNCHECKED_DIGITS) w = w * 10 + (bytes[i] - ZERO)
+            if (w != 0L) significant++
+            digits++
+            i++
+        }
+        if (i < last && bytes[i] == DOT) {
+            i++
+            while (i < last && isDigit(bytes[i])) {
+                if (significant < MAX_UNCHECKED_DIGITS) {
+                    w = w * 10 + (bytes[i] - ZERO)
+                    q--
+                }
+                if (w != 0L) significant++
+                digits++
+                i++
+            }
+        }
+        if (digits == 0) mismatch("float")
+
+        if (i < last && (bytes[i] == 'e'.code.toByte() || bytes[i] == 'E'.code.toByte())) {
+            i++
+            val negativeExponent = i < last && bytes[i] == MINUS
+            if (negativeExponent || (i < last && bytes[i] == PLUS)) i++
+            if (i == last || !isDigit(bytes[i])) mismatch("float")
+            var exponent = 0
+            while (i < last && isDigit(bytes[i])) {
+                exponent = minOf(exponent * 10 + (bytes[i] - ZERO), MAX_EXPONENT)
+                i++
+            }
+            q += if (negativeExponent) -exponent else exponent
+        }
+        if (i != last) mismatch("float")
+
+        if (significant <= MAX_UNCHECKED_DIGITS) {
+            val bits = DecimalKernels.toBits(format, w, q, negative)
+            if (bits != -1L) return bits
+        }
+        val text = String(bytes, start, last - start, Charsets.ISO_8859_1)
+        return if (format === DecimalKernels.DOUBLE) {
+            text.toDouble().toRawBits()
+        } else {
+            text.toFloat().toRawBits().toLong()
+        }
+    }
+
+    private fun isDigit(b: Byte): Boolean = b >= ZERO && b <= '9'.code.toByte()
+
+    fun parseBoolean(bytes: ByteArray, from: Int, to: Int): Boolean = when (token(bytes, from, to)) {
+        "t", "true" -> true
+        "f", "false" -> false
+        else -> mismatch("bool")
+    }
+
+    /** Accepts an empty payload or `null`. */
+    fun checkNull(bytes: ByteArray, from: Int, to: Int) {
+        val text = token(bytes, from, to)
+        if (text.isNotEmpty() && text != "null") mismatch("null")
+    }
+
+    /**
+     * Check a string is well-formed UTF-8 and fits `s[bound]`. Bounds
+     * count characters (code points), not bytes.
+     */
+    fun checkLength(bound: Int, bytes: ByteArray, from: Int, to: Int) {
+        val chars = utf8Counter.count(bytes, from, to)
+        if (chars < 0) {
+            throw GblnSyntaxException(GblnErrorCode.ERROR_UNEXPECTED_CHAR, "Invalid UTF-8 in string")
+        }
+        if (chars > bound) {
+            throw GblnSyntaxException(GblnErrorCode.ERROR_STRING_TOO_LONG, "String of $chars characters exceeds s$bound")
+        }
+    }
+
+    /**
+     * Copy `bytes[from until to]` into [dest], resolving backslash escapes.
+     * [dest] must hold `to - from` bytes.
+     *
+     * @return number of bytes written
+     */
+    fun unescape(bytes: ByteArray, from: Int, to: Int, dest: ByteArray): Int {
+        var n = 0
+        var i = from
+        while (i < to) {
+            var b = bytes[i]
+            if (b == BACKSLASH && i + 1 < to) {
+                i++
+                b = bytes[i]
+            }
+            dest[n++] = b
+            i++
+        }
+        return n
+    }
+
+    fun isWhitespace(b: Byte): Boolean =
+        b == ' '.code.toByte() || b == '\n'.code.toByte() || b == '\t'.code.toByte() || b == '\r'.code.toByte()
+
+    private fun token(bytes: ByteArray, from: Int, to: Int): String = String(bytes, from, to - from, Charsets.UTF_8).trim()
+
+    private fun mismatch(expected: String): Nothing =
+        throw GblnSyntaxException(GblnErrorCode.ERROR_TYPE_MISMATCH, "Invalid $expected value")
+
+    private fun outOfRange(type: Int): Nothing =
+        throw GblnSyntaxException(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, "Value out of range for ${GblnValueType.nameOf(type)}")
+}
@@ -47,7 +47,7 @@ fun toString(value: ManagedGblnValue, mini: Boolean = true): String {
 
     // Convert to Kotlin string
     return try {
-        cStrPtr.getString(0, "UTF-8")
+        readUtf8(cStrPtr)
     } finally {
         // Free C string
         com.sun.jna.Native.free(Pointer.nativeValue(cStrPtr))
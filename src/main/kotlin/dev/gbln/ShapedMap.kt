@@ -0,0 +1,215 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+/**
+ * Shape-shared compact maps.
+ *
+ * Arrays of records usually repeat one key sequence thousands of times.
+ * With GblnParseOptions.compactObjects, every object is a ShapedMap: an
+ * immutable, ordered map holding only an array of values, plus a reference
+ * to a GblnShape (the key sequence) that all objects with the same keys in
+ * the same order share. Key lookup scans the keys linearly for small
+ * shapes and uses the shape's own hash index, built once, for large ones.
+ */
+
+/**
+ * Interned key sequence shared by all ShapedMaps with these keys.
+ */
+internal class GblnShape(val keys: Array<String>) {
+
+    /** Hash index of key positions (+1; 0 = empty), only for large shapes. */
+    private val index: IntArray?
+
+    /** False if a key repeats; such objects fall back to LinkedHashMap. */
+    val unique: Boolean
+
+    init {
+        if (keys.size <= SMALL_SHAPE) {
+            index = null
+            unique = keys.indices.all { i -> (0 until i).none { keys[it] == keys[i] } }
+        } else {
+            val table = IntArray(Integer.highestOneBit(keys.size) shl 2)
+            val mask = table.size - 1
+            var distinct = true
+            for (i in keys.indices) {
+                var slot = spread(keys[i].hashCode()) and mask
+                while (table[slot] != 0) {
+                    if (keys[table[slot] - 1] == keys[i]) distinct = false
+                    slot = (slot + 1) and mask
+                }
+                table[slot] = i + 1
+            }
+            index = table
+            unique = distinct
+        }
+    }
+
+    val size: Int get() = keys.size
+
+    /**
+     * Position of [key] in this shape, or -1.
+     */
+    fun indexOf(key: Any?): Int {
+        if (key !is String) {
+            return -1
+        }
+
+        val table = index
+        if (table == null) {
+            // Identity first: keys taken from a ShapedMap hit immediately
+            for (i in keys.indices) {
+                if (keys[i] === key) return i
+            }
+            for (i in keys.indices) {
+                if (keys[i] == key) return i
+            }
+            return -1
+        }
+
+        val mask = table.size - 1
+        var slot = spread(key.hashCode()) and mask
+        while (true) {
+            val entry = table[slot]
+            if (entry == 0) return -1
+            if (keys[entry - 1] == key) return entry - 1
+            slot = (slot + 1) and mask
+        }
+    }
+
+    private fun spread(hash: Int): Int = hash xor (hash ushr 16)
+
+    companion object {
+        /** Shapes up to this many keys are searched linearly. */
+        const val SMALL_SHAPE = 8
+    }
+}
+
+/**
+ * Per-conversion shape interning.
+ *
+ * Shapes are found by following key transitions from the empty shape, so
+ * building an object costs one cached transition per key and no temporary
+ * key arrays. The table lives only as long as one conversion; the shapes
+ * it hands out live as long as the maps that use them.
+ */
+internal class ShapeTable {
+
+    /**
+     * Node in the key transition tree: the key sequence root → this node.
+     */
+    class Transition internal constructor(
+        private val parent: Transition?,
+        private val key: String?,
+        private val depth: Int
+    ) {
+        // Most lookups repeat the previous transition
+        private var lastKey: String? = null
+        private var lastNext: Transition? = null
+        private var next: HashMap<String, Transition>? = null
+        private var shape: GblnShape? = null
+
+        /**
+         * The transition for appending [key].
+         */
+        fun next(key: String): Transition {
+            val last = lastKey
+            if (last != null && (last === key || last == key)) {
+                return lastNext!!
+            }
+
+            val map = next ?: HashMap<String, Transition>(4).also { next = it }
+            val result = map.getOrPut(key) { Transition(this, key, depth + 1) }
+            lastKey = key
+            lastNext = result
+            return result
+        }
+
+        /**
+         * The shared shape for this key sequence.
+         */
+        fun shape(): GblnShape {
+            shape?.let { return it }
+
+            val keys = arrayOfNulls<String>(depth)
+            var node: Transition? = this
+            while (node != null && node.depth > 0) {
+                keys[node.depth - 1] = node.key
+                node = node.parent
+            }
+            @Suppress("UNCHECKED_CAST")
+            return GblnShape(keys as Array<String>).also { shape = it }
+        }
+    }
+
+    /** The empty shape every object starts from. */
+    val root = Transition(null, null, 0)
+
+    /**
+     * Build the map for an object whose keys led to [transition].
+     *
+     * @param values Field values in key order; taken over, not copied
+     */
+    fun build(transition: Transition, values: Array<Any?>): Map<String, Any?> {
+        val shape = transition.shape()
+        if (shape.unique) {
+            return ShapedMap(shape, values)
+        }
+
+        // Repeated keys: the last occurrence wins, as with LinkedHashMap
+        val result = LinkedHashMap<String, Any?>(mapCapacity(shape.size))
+        for (i in values.indices) {
+            result[shape.keys[i]] = values[i]
+        }
+        return result
+    }
+}
+
+/**
+ * Immutable, ordered Map backed by a shared GblnShape and a value array.
+ */
+internal class ShapedMap(
+    internal val shape: GblnShape,
+    private val fieldValues: Array<Any?>
+) : AbstractMap<String, Any?>() {
+
+    override val size: Int get() = fieldValues.size
+
+    override fun isEmpty(): Boolean = fieldValues.isEmpty()
+
+    override fun containsKey(key: String): Boolean = shape.indexOf(key) >= 0
+
+    override fun get(key: String): Any? {
+        val i = shape.indexOf(key)
+        return if (i >= 0) fieldValues[i] else null
+    }
+
+    override val keys: Set<String>
+        get() = object : AbstractSet<String>() {
+            override val size: Int get() = fieldValues.size
+            override fun contains(element: String): Boolean = shape.indexOf(element) >= 0
+            override fun iterator(): Iterator<String> = shape.keys.iterator()
+        }
+
+    override val values: Collection<Any?>
+        get() = object : AbstractList<Any?>() {
+            override val size: Int get() = fieldValues.size
+            override fun get(index: Int): Any? = fieldValues[index]
+        }
+
+    override val entries: Set<Map.Entry<String, Any?>>
+        get() = object : AbstractSet<Map.Entry<String, Any?>>() {
+            override val size: Int get() = fieldValues.size
+            override fun iterator(): Iterator<Map.Entry<String, Any?>> = object : Iterator<Map.Entry<String, Any?>> {
+                private var i = 0
+                override fun hasNext(): Boolean = i < fieldValues.size
+                override fun next(): Map.Entry<String, Any?> {
+                    if (i >= fieldValues.size) throw NoSuchElementException()
+                    val entry = java.util.AbstractMap.SimpleImmutableEntry(shape.keys[i], fieldValues[i])
+                    i++
+                    return entry
+                }
+            }
+        }
+}
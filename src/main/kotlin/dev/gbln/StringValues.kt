@@ -0,0 +1,150 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Memory
+import com.sun.jna.Pointer
+import java.nio.ByteBuffer
+
+/**
+ * Conversion of string values to Strings.
+ *
+ * Strings owned by libgbln are scanned once through a direct view of
+ * native memory: the scan finds the terminator and tells ASCII and
+ * Latin-1 text apart. Those are built straight into compact (one byte
+ * per char) Strings. Only text beyond U+00FF goes through the UTF-8
+ * decoder. Under the Panama backend, values that are not deduplicated
+ * are read by its NativeStringReader instead, without any JNA views.
+ *
+ * With GblnParseOptions.dedupStrings, values up to [MAX_DEDUP_BYTES]
+ * also go through a process-wide table shaped like KeyInterner's:
+ * enum-like statuses, country codes or hostnames share one instance,
+ * and a repeated value is neither copied nor decoded. Set the slot count
+ * with -Dgbln.dedupStrings=<n> (rounded up to a power of two, 0 disables).
+ */
+internal object StringValues {
+
+    /** Longer values are never deduplicated. */
+    const val MAX_DEDUP_BYTES = 32
+
+    private const val DEFAULT_SLOTS = 4096
+
+    // Bytes of native memory viewed at once while looking for the terminator
+    private const val WINDOW = 256
+
+    private class Entry(val hash: Int, val bytes: ByteArray, val string: String)
+
+    private val slots: Array<Entry?> = arrayOfNulls(internSlots("gbln.dedupStrings", DEFAULT_SLOTS))
+    private val mask = slots.size - 1
+
+    /**
+     * String for the UTF-8 bytes `bytes[offset until offset + length]`.
+     */
+    fun decode(bytes: ByteArray, offset: Int, length: Int, dedup: Boolean): String {
+        if (!dedup || length > MAX_DEDUP_BYTES || slots.isEmpty()) {
+            // The JDK's UTF-8 constructor already builds compact Strings
+            // from ASCII and Latin-1 text without a charset decoder
+            return String(bytes, offset, length, Charsets.UTF_8)
+        }
+
+        var hash = 1
+        for (i in offset until offset + length) {
+            hash = 31 * hash + bytes[i]
+        }
+
+        val slot = (hash xor (hash ushr 16)) and mask
+        val entry = slots[slot]
+        if (entry != null && entry.hash == hash &&
+            java.util.Arrays.equals(entry.bytes, 0, entry.bytes.size, bytes, offset, offset + length)
+        ) {
+            return entry.string
+        }
+
+        val copy = bytes.copyOfRange(offset, offset + length)
+        val string = String(copy, Charsets.UTF_8)
+        slots[slot] = Entry(hash, copy, string)
+        return string
+    }
+
+    /**
+     * String for the NUL-terminated UTF-8 string at [str], which libgbln
+     * owns.
+     */
+    fun read(str: Pointer, dedup: Boolean): String {
+        if (!dedup || slots.isEmpty()) {
+            (lib as? NativeStringReader)?.let { return it.readUtf8(Pointer.nativeValue(str)) }
+        }
+
+        // JNA bounds-checks views of its own allocations
+        val limit = (str as? Memory)?.size() ?: Long.MAX_VALUE
+        var window = minOf(WINDOW.toLong(), limit).toInt()
+        var buf: ByteBuffer = str.getByteBuffer(0, window.toLong())
+        var hash = 1
+        var length = 0
+        var firstNonAscii = -1
+        while (true) {
+            if (length == window) {
+                window = minOf(window * 2L, limit).toInt()
+                buf = str.getByteBuffer(0, window.toLong())
+            }
+            val b = buf.get(length)
+            if (b == 0.toByte()) break
+            if (b < 0 && firstNonAscii < 0) firstNonAscii = length
+            hash = 31 * hash + b
+            length++
+        }
+
+        val cached = dedup && length <= MAX_DEDUP_BYTES && slots.isNotEmpty()
+        val slot = (hash xor (hash ushr 16)) and mask
+        if (cached) {
+            val entry = slots[slot]
+            if (entry != null && entry.hash == hash && entry.bytes.size == length && matches(entry.bytes, buf)) {
+                return entry.string
+            }
+        }
+
+        val bytes = ByteArray(length)
+        buf.get(0, bytes)
+        val string = when {
+            firstNonAscii < 0 -> String(bytes, Charsets.ISO_8859_1)
+            else -> latin1(bytes, firstNonAscii) ?: String(bytes, Charsets.UTF_8)
+        }
+        if (cached) {
+            slots[slot] = Entry(hash, bytes, string)
+        }
+        return string
+    }
+
+    /**
+     * Decode UTF-8 [bytes] as Latin-1 when every character is below
+     * U+0100, or return null. The first non-ASCII byte is at [from].
+     */
+    private fun latin1(bytes: ByteArray, from: Int): String? {
+        val out = bytes.copyOf()
+        var n = from
+        var i = from
+        while (i < bytes.size) {
+            val b = bytes[i].toInt()
+            if (b >= 0) {
+                out[n++] = b.toByte()
+                i++
+                continue
+            }
+            // U+0080..U+00FF is C2 or C3 and one continuation byte
+            if ((b and 0xFE) != 0xC2 || i + 1 == bytes.size) return null
+            val next = bytes[i + 1].toInt()
+            if ((next and 0xC0) != 0x80) return null
+            out[n++] = (((b and 0x03) shl 6) or (next and 0x3F)).toByte()
+            i += 2
+        }
+        return String(out, 0, n, Charsets.ISO_8859_1)
+    }
+
+    private fun matches(bytes: ByteArray, buf: ByteBuffer): Boolean {
+        for (i in bytes.indices) {
+            if (bytes[i] != buf.get(i)) return false
+        }
+        return true
+    }
+}
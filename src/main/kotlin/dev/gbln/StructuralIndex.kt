@@ -0,0 +1,161 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+/**
+ * Positions of the structural bytes `{ } [ ] ( ) < >`, `\` and `:` in a
+ * range of UTF-8 input, in ascending order.
+ *
+ * Built by a StructuralScanner as stage one of JvmParser. With the index
+ * the parser jumps from one delimiter to the next instead of visiting
+ * every byte of string payloads, and ParallelParser finds split points
+ * without a byte-level pass. Entries inside comments or escaped by a
+ * backslash are still listed; consumers skip past them by position.
+ * `:` is listed so comments (`:|`) can be recognised.
+ */
+internal class StructuralIndex(initialCapacity: Int = 64) {
+
+    /** Positions; only the first [size] are valid. */
+    var positions = IntArray(maxOf(initialCapacity, 16))
+        private set
+
+    var size = 0
+        private set
+
+    /**
+     * Index of the first entry at or after [position] (binary search).
+     */
+    fun lowerBound(position: Int): Int {
+        var low = 0
+        var high = size
+        while (low < high) {
+            val mid = (low + high) ushr 1
+            if (positions[mid] < position) low = mid + 1 else high = mid
+        }
+        return low
+    }
+
+    /** Append the entries of [other], which must all follow ours. */
+    fun addAll(other: StructuralIndex) {
+        if (size + other.size > positions.size) {
+            positions = positions.copyOf(maxOf(size + other.size, size * 2))
+        }
+        System.arraycopy(other.positions, 0, positions, size, other.size)
+        size += other.size
+    }
+
+    fun add(position: Int) {
+        if (size == positions.size) {
+            positions = positions.copyOf(size * 2)
+        }
+        positions[size++] = position
+    }
+
+    /**
+     * Index of the first entry at or after [position], searching forward
+     * from entry [from].
+     */
+    fun seek(from: Int, position: Int): Int {
+        var i = from
+        while (i < size && positions[i] < position) i++
+        return i
+    }
+}
+
+/**
+ * Stage-one scanner producing a StructuralIndex.
+ */
+internal abstract class StructuralScanner {
+
+    /** Short name for diagnostics and benchmarks. */
+    abstract val name: String
+
+    /**
+     * Index the structural bytes of `input[from until to]`.
+     */
+    abstract fun scan(input: ByteArray, from: Int, to: Int): StructuralIndex
+
+    companion object {
+        private val BRACKETS = BooleanArray(256).apply {
+            for (c in "{}[]()<>") this[c.code] = true
+        }
+
+        private val STRUCTURAL = BRACKETS.copyOf().apply {
+            this['\\'.code] = true
+            this[':'.code] = true
+        }
+
+        /** True if [b] is one of the bytes a StructuralIndex records. */
+        @JvmStatic
+        fun isStructural(b: Byte): Boolean = STRUCTURAL[b.toInt() and 0xFF]
+
+        /** True if [b] is one of `{ } [ ] ( ) < >`. */
+        @JvmStatic
+        fun isBracket(b: Byte): Boolean = BRACKETS[b.toInt() and 0xFF]
+
+        /** Expected share of structural bytes, used to pre-size the index. */
+        internal fun capacityFor(length: Int): Int = length ushr 4
+    }
+}
+
+/**
+ * Byte-at-a-time scanner; used when jdk.incubator.vector is unavailable
+ * and for the tails the vector scanner leaves.
+ */
+internal object ScalarStructuralScanner : StructuralScanner() {
+
+    override val name: String get() = "scalar"
+
+    override fun scan(input: ByteArray, from: Int, to: Int): StructuralIndex {
+        val index = StructuralIndex(StructuralScanner.capacityFor(to - from))
+        scanInto(index, input, from, to)
+        return index
+    }
+
+    fun scanInto(index: StructuralIndex, input: ByteArray, from: Int, to: Int) {
+        for (i in from until to) {
+            if (StructuralScanner.isStructural(input[i])) index.add(i)
+        }
+    }
+}
+
+/**
+ * Scanner used by the JVM engine: the Vector API implementation when
+ * the JVM runs with `--add-modules jdk.incubator.vector`, the scalar one
+ * otherwise. `-Dgbln.vector=false` forces the scalar scanner.
+ */
+internal val structuralScanner: StructuralScanner by lazy {
+    loadVectorKernel("dev.gbln.VectorStructuralScanner") as StructuralScanner? ?: ScalarStructuralScanner
+}
+
+/**
+ * Documents at least this large are indexed before parsing; smaller ones
+ * are parsed byte by byte, where building the index would not pay off.
+ * Override with -Dgbln.structuralIndexThreshold=<bytes>.
+ */
+internal val structuralIndexThreshold: Int =
+    System.getProperty("gbln.structuralIndexThreshold")?.toIntOrNull() ?: (64 * 1024)
+
+/**
+ * Instance of the Vector API object [className], or null when the
+ * incubator module is not in the boot layer (loading the class would
+ * fail) or `-Dgbln.vector=false` is set.
+ */
+internal fun loadVectorKernel(className: String): Any? {
+    if (System.getProperty("gbln.vector") == "false") {
+        return null
+    }
+    if (!ModuleLayer.boot().findModule("jdk.incubator.vector").isPresent) {
+        return null
+    }
+
+    return try {
+        val cls = Class.forName(className, true, StructuralScanner::class.java.classLoader)
+        cls.getField("INSTANCE").get(null)
+    } catch (e: ReflectiveOperationException) {
+        null
+    } catch (e: LinkageError) {
+        null
+    }
+}
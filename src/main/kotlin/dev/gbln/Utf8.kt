@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import java.lang.invoke.MethodHandles
+import java.lang.invoke.VarHandle
+import java.nio.ByteOrder
+
+/**
+ * UTF-8 validation and code point counting in one pass, for the sN
+ * bounds of string payloads.
+ */
+internal abstract class Utf8Counter {
+
+    /** Short name for diagnostics and benchmarks. */
+    abstract val name: String
+
+    /**
+     * Number of code points in `bytes[from until to]`, or -1 if the range
+     * is not well-formed UTF-8 (RFC 3629: no overlong forms, surrogates,
+     * values above U+10FFFF or truncated sequences).
+     */
+    abstract fun count(bytes: ByteArray, from: Int, to: Int): Int
+}
+
+/**
+ * Scalar counter with a SWAR fast path: eight ASCII bytes are recognised
+ * with one 64-bit test, and only multi-byte sequences are decoded.
+ */
+internal object SwarUtf8Counter : Utf8Counter() {
+
+    private val LONG_LE: VarHandle = MethodHandles.byteArrayViewVarHandle(LongArray::class.java, ByteOrder.LITTLE_ENDIAN)
+
+    private const val HIGH_BITS = 0x7F7F7F7F7F7F7F7FL.inv()
+
+    override val name: String get() = "swar"
+
+    override fun count(bytes: ByteArray, from: Int, to: Int): Int {
+        var i = from
+        var count = 0
+        while (i < to) {
+            if (to - i >= 8 && ((LONG_LE.get(bytes, i) as Long) and HIGH_BITS) == 0L) {
+                i += 8
+                count += 8
+                continue
+            }
+            val b = bytes[i].toInt() and 0xFF
+            if (b < 0x80) {
+                i++
+                count++
+                continue
+            }
+
+            // Continuation count and the allowed range of the second byte
+            val length: Int
+            var low = 0x80
+            var high = 0xBF
+            when {
+                b in 0xC2..0xDF -> length = 2
+                b in 0xE0..0xEF -> {
+                    length = 3
+                    if (b == 0xE0) low = 0xA0
+                    if (b == 0xED) high = 0x9F
+                }
+                b in 0xF0..0xF4 -> {
+                    length = 4
+                    if (b == 0xF0) low = 0x90
+                    if (b == 0xF4) high = 0x8F
+                }
+                else -> return -1
+            }
+            if (to - i < length) return -1
+            val second = bytes[i + 1].toInt() and 0xFF
+            if (second < low || second > high) return -1
+            for (k in 2 until length) {
+                if ((bytes[i + k].toInt() and 0xC0) != 0x80) return -1
+            }
+            i += length
+            count++
+        }
+        return count
+    }
+}
+
+/**
+ * Counter used by the JVM parsers: the Vector API implementation when
+ * the JVM runs with `--add-modules jdk.incubator.vector`, the SWAR one
+ * otherwise. `-Dgbln.vector=false` forces SWAR.
+ */
+internal val utf8Counter: Utf8Counter by lazy {
+    loadVectorKernel("dev.gbln.VectorUtf8Counter") as Utf8Counter? ?: SwarUtf8Counter
+}
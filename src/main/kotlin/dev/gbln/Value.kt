@@ -16,6 +16,8 @@
 
 package dev.gbln
 
+import com.sun.jna.Function
+import com.sun.jna.NativeLibrary
 import com.sun.jna.Pointer
 import java.lang.ref.Cleaner
 
@@ -31,16 +33,50 @@ import java.lang.ref.Cleaner
 private val cleaner = Cleaner.create()
 
 /**
- * GBLN Value with automatic memory management.
+ * GBLN Value with explicit and automatic memory management.
  *
- * Uses Cleaner to automatically free C memory when Kotlin object
- * is garbage collected. Prevents double-free and use-after-free errors.
+ * close() frees the C memory immediately and is idempotent; use it (or
+ * Kotlin's `use {}`) for deterministic native memory usage. The Cleaner
+ * remains as a safety net that frees the value when the Kotlin object is
+ * garbage collected without having been closed. Prevents double-free and
+ * use-after-free errors: accessing [ptr] after close() throws.
  */
-class ManagedGblnValue(val ptr: Pointer) {
+class ManagedGblnValue(ptr: Pointer) : AutoCloseable {
 
-    init {
-        // Register cleanup action
-        cleaner.register(this, CleanupAction(ptr))
+    private val rawPtr = ptr
+
+    // Register cleanup action; clean() runs it at most once and
+    // deregisters it, so closed values cost the Cleaner thread nothing
+    private val cleanable = cleaner.register(this, CleanupAction(ptr))
+
+    @Volatile
+    private var closed = false
+
+    /**
+     * Pointer to the underlying GblnValue.
+     *
+     * @throws IllegalStateException if the value has been closed
+     */
+    val ptr: Pointer
+        get() {
+            check(!closed) { "GBLN value has been closed" }
+            return rawPtr
+        }
+
+    /**
+     * True once close() has been called.
+     */
+    val isClosed: Boolean
+        get() = closed
+
+    /**
+     * Free the C memory now. Further calls do nothing.
+     */
+    override fun close() {
+        if (!closed) {
+            closed = true
+            cleanable.clean()
+        }
     }
 
     private class CleanupAction(private val ptr: Pointer) : Runnable {
@@ -50,22 +86,113 @@ class ManagedGblnValue(val ptr: Pointer) {
     }
 }
 
+/**
+ * Scope that owns many GBLN values and frees them all at once.
+ *
+ * Values parsed through the arena (or handed to [adopt]) are closed in
+ * reverse order when the arena is closed. Each value keeps its own Cleaner
+ * safety net, so an arena that is never closed still leaks nothing.
+ *
+ * Example:
+ * ```kotlin
+ * GblnArena().use { arena ->
+ *     val a = arena.parseRaw(first)
+ *     val b = arena.parseRaw(second)
+ *     writeIo(a, "a.io.gbln")
+ *     writeIo(b, "b.io.gbln")
+ * } // both values freed here
+ * ```
+ */
+class GblnArena : AutoCloseable {
+
+    private val values = ArrayList<ManagedGblnValue>()
+
+    private var closed = false
+
+    /**
+     * Transfer ownership of [value] to this arena.
+     *
+     * @return the same value, for chaining
+     * @throws IllegalStateException if the arena has been closed
+     */
+    fun adopt(value: ManagedGblnValue): ManagedGblnValue {
+        synchronized(values) {
+            if (closed) {
+                value.close()
+                throw IllegalStateException("GBLN arena has been closed")
+            }
+            values.add(value)
+        }
+        return value
+    }
+
+    /** parseRaw() into this arena. */
+    fun parseRaw(gblnString: String): ManagedGblnValue = adopt(dev.gbln.parseRaw(gblnString))
+
+    /** parseRaw() of UTF-8 bytes into this arena. */
+    fun parseRaw(bytes: ByteArray, offset: Int = 0, length: Int = bytes.size - offset): ManagedGblnValue =
+        adopt(dev.gbln.parseRaw(bytes, offset, length))
+
+    /** parseRaw() of a buffer into this arena. */
+    fun parseRaw(buffer: java.nio.ByteBuffer): ManagedGblnValue = adopt(dev.gbln.parseRaw(buffer))
+
+    /** parseFileRaw() into this arena. */
+    fun parseFileRaw(filePath: java.nio.file.Path): ManagedGblnValue = adopt(dev.gbln.parseFileRaw(filePath))
+
+    /** readIoRaw() into this arena. */
+    fun readIoRaw(path: String): ManagedGblnValue = adopt(dev.gbln.readIoRaw(path))
+
+    /**
+     * Free every value owned by the arena. Further calls do nothing.
+     */
+    override fun close() {
+        val owned = synchronized(values) {
+            if (closed) return
+            closed = true
+            values.toTypedArray().also { values.clear() }
+        }
+        for (i in owned.indices.reversed()) {
+            owned[i].close()
+        }
+    }
+}
+
 /**
  * Convert GBLN Value to Kotlin value.
  *
- * Uses gbln_value_type() for efficient type detection.
- * Recursively converts GBLN objects and arrays to Kotlin Map/List.
- * Handles all GBLN types (integers, floats, strings, bool, null).
+ * Checks the pointer, then walks the tree node by node (walkToKotlin).
  *
  * @param value Pointer to GblnValue from C FFI
+ * @param options Result shape options
  * @return Kotlin Map, List, or primitive value
  * @throws GblnError if conversion fails or unknown type encountered
  */
-internal fun gblnToKotlin(value: Pointer?): Any? {
+internal fun gblnToKotlin(value: Pointer?, options: GblnParseOptions = GblnParseOptions.DEFAULT): Any? {
     if (value == null || Pointer.nativeValue(value) == 0L) {
         throw ValidationError("Null pointer passed to gblnToKotlin")
     }
 
+    return walkToKotlin(value, options)
+}
+
+/**
+ * Convert GBLN Value to Kotlin value one node at a time.
+ *
+ * Uses gbln_value_type() for efficient type detection.
+ * Recursively converts GBLN objects and arrays to Kotlin Map/List.
+ * Handles all GBLN types (integers, floats, strings, bool, null).
+ *
+ * @param value Pointer to GblnValue from C FFI
+ * @param options Result shape options
+ * @param shapes Shape table of the whole conversion (compactObjects only)
+ * @return Kotlin Map, List, or primitive value
+ * @throws GblnError if conversion fails or unknown type encountered
+ */
+internal fun walkToKotlin(
+    value: Pointer,
+    options: GblnParseOptions = GblnParseOptions.DEFAULT,
+    shapes: ShapeTable? = if (options.compactObjects) ShapeTable() else null
+): Any? {
     // Use gbln_value_type() for efficient type detection
     val valueType = lib.gbln_value_type(value)
 
@@ -153,7 +280,7 @@ internal fun gblnToKotlin(value: Pointer?): Any? {
             if (ok[0] != 0.toByte()) {
                 if (strPtr != null && Pointer.nativeValue(strPtr) != 0L) {
                     // NOTE: String is owned by the Value - don't free
-                    strPtr.getString(0, "UTF-8")
+                    StringValues.read(strPtr, options.dedupStrings)
                 } else {
                     ""
                 }
@@ -164,38 +291,298 @@ internal fun gblnToKotlin(value: Pointer?): Any? {
 
         // Array
         GblnValueType.ARRAY -> {
-            val result = mutableListOf<Any?>()
             val arrayLen = lib.gbln_array_len(value)
-            for (i in 0 until arrayLen) {
-                val elem = lib.gbln_array_get(value, i)
-                if (elem != null && Pointer.nativeValue(elem) != 0L) {
-                    result.add(gblnToKotlin(elem))
+            val primitive = if (options.primitiveArrays && arrayLen > 0) {
+                walkPrimitiveArray(value, arrayLen.toInt())
+            } else {
+                null
+            }
+
+            primitive ?: run {
+                val result = ArrayList<Any?>(arrayLen.toInt())
+                for (i in 0 until arrayLen) {
+                    val elem = lib.gbln_array_get(value, i)
+                    if (elem != null && Pointer.nativeValue(elem) != 0L) {
+                        result.add(walkToKotlin(elem, options, shapes))
+                    }
                 }
+                result
             }
-            result
         }
 
         // Object
         GblnValueType.OBJECT -> {
-            val result = mutableMapOf<String, Any?>()
-            val countRef = com.sun.jna.ptr.LongByReference()
-            val keysPtr = lib.gbln_object_keys(value, countRef)
-
-            if (keysPtr != null && Pointer.nativeValue(keysPtr) != 0L) {
-                val count = countRef.value.toInt()
-                val keys = keysPtr.getStringArray(0, count)
+            val keys = readObjectKeys(value)
 
+            if (shapes != null) {
+                var transition = shapes.root
+                val values = ArrayList<Any?>(keys.size)
                 for (key in keys) {
                     val fieldValue = lib.gbln_object_get(value, key)
                     if (fieldValue != null && Pointer.nativeValue(fieldValue) != 0L) {
-                        result[key] = gblnToKotlin(fieldValue)
+                        transition = transition.next(key)
+                        values.add(walkToKotlin(fieldValue, options, shapes))
                     }
                 }
+                shapes.build(transition, values.toTypedArray())
+            } else {
+                val result = LinkedHashMap<String, Any?>(mapCapacity(keys.size))
+                for (key in keys) {
+                    val fieldValue = lib.gbln_object_get(value, key)
+                    if (fieldValue != null && Pointer.nativeValue(fieldValue) != 0L) {
+                        result[key] = walkToKotlin(fieldValue, options, shapes)
+                    }
+                }
+                result
             }
-
-            result
         }
 
         else -> throw ValidationError("Unknown value type: $valueType")
     }
 }
+
+/**
+ * Convert a native tree keeping only the members selected by [node] (see
+ * GblnProjection). Unprojected members are looked up by key only; their
+ * values are never visited.
+ */
+internal fun walkProjected(
+    value: Pointer,
+    node: GblnProjection.Node,
+    options: GblnParseOptions,
+    shapes: ShapeTable? = if (options.compactObjects) ShapeTable() else null
+): Any? {
+    if (node.keepAll) {
+        return walkToKotlin(value, options, shapes)
+    }
+
+    return when (lib.gbln_value_type(value)) {
+        // Paths apply through arrays, to every element
+        GblnValueType.ARRAY -> {
+            val arrayLen = lib.gbln_array_len(value)
+            val primitive = if (options.primitiveArrays && arrayLen > 0) {
+                walkPrimitiveArray(value, arrayLen.toInt())
+            } else {
+                null
+            }
+
+            primitive ?: run {
+                val result = ArrayList<Any?>(arrayLen.toInt())
+                for (i in 0 until arrayLen) {
+                    val elem = lib.gbln_array_get(value, i)
+                    if (elem != null && Pointer.nativeValue(elem) != 0L) {
+                        result.add(walkProjected(elem, node, options, shapes))
+                    }
+                }
+                result
+            }
+        }
+
+        GblnValueType.OBJECT -> {
+            val keys = ArrayList<String>()
+            val values = ArrayList<Any?>()
+            for (key in readObjectKeys(value)) {
+                val child = node.child(key) ?: continue
+                val fieldValue = lib.gbln_object_get(value, key)
+                if (fieldValue != null && Pointer.nativeValue(fieldValue) != 0L) {
+                    keys.add(key)
+                    values.add(walkProjected(fieldValue, child, options, shapes))
+                }
+            }
+
+            if (shapes != null) {
+                var transition = shapes.root
+                for (key in keys) transition = transition.next(key)
+                shapes.build(transition, values.toTypedArray())
+            } else {
+                val result = LinkedHashMap<String, Any?>(mapCapacity(keys.size))
+                for (i in keys.indices) result[keys[i]] = values[i]
+                result
+            }
+        }
+
+        else -> walkToKotlin(value, options, shapes)
+    }
+}
+
+/**
+ * Convert an array to a primitive array if all elements share one
+ * numeric or bool type (see GblnParseOptions.primitiveArrays).
+ *
+ * @return the primitive array, or null if the array is not homogeneous
+ */
+private fun walkPrimitiveArray(array: Pointer, count: Int): Any? {
+    val elems = arrayOfNulls<Pointer>(count)
+    var elemType = -1
+    for (i in 0 until count) {
+        val elem = lib.gbln_array_get(array, i.toLong())
+        if (elem == null || Pointer.nativeValue(elem) == 0L) {
+            return null
+        }
+
+        val type = lib.gbln_value_type(elem)
+        if (i == 0) {
+            if (!isPrimitiveArrayType(type)) return null
+            elemType = type
+        } else if (type != elemType) {
+            return null
+        }
+        elems[i] = elem
+    }
+
+    return when (elemType) {
+        GblnValueType.I8 -> ByteArray(count).also { a ->
+            for (i in 0 until count) a[i] = readLong(elems[i]!!, elemType).toByte()
+        }
+        GblnValueType.I16, GblnValueType.U8 -> ShortArray(count).also { a ->
+            for (i in 0 until count) a[i] = readLong(elems[i]!!, elemType).toShort()
+        }
+        GblnValueType.I32, GblnValueType.U16 -> IntArray(count).also { a ->
+            for (i in 0 until count) a[i] = readLong(elems[i]!!, elemType).toInt()
+        }
+        GblnValueType.I64, GblnValueType.U32, GblnValueType.U64 -> LongArray(count).also { a ->
+            for (i in 0 until count) a[i] = readLong(elems[i]!!, elemType)
+        }
+        GblnValueType.F32 -> FloatArray(count).also { a ->
+            for (i in 0 until count) a[i] = readDouble(elems[i]!!, elemType).toFloat()
+        }
+        GblnValueType.F64 -> DoubleArray(count).also { a ->
+            for (i in 0 until count) a[i] = readDouble(elems[i]!!, elemType)
+        }
+        else -> BooleanArray(count).also { a ->
+            for (i in 0 until count) a[i] = readBoolean(elems[i]!!, elemType)
+        }
+    }
+}
+
+/**
+ * True for element types that have a primitive array representation.
+ */
+internal fun isPrimitiveArrayType(valueType: Int): Boolean =
+    valueType in GblnValueType.I8..GblnValueType.BOOL
+
+/**
+ * Read an integer value of any width as Long, without boxing.
+ *
+ * Unsigned values widen as in walkToKotlin(); u64 keeps its bit pattern.
+ *
+ * @throws ValidationError if the value is not an integer
+ */
+internal fun readLong(value: Pointer, valueType: Int): Long {
+    val ok = ByteArray(1)
+    val result = when (valueType) {
+        GblnValueType.I8 -> lib.gbln_value_as_i8(value, ok).toLong()
+        GblnValueType.I16 -> lib.gbln_value_as_i16(value, ok).toLong()
+        GblnValueType.I32 -> lib.gbln_value_as_i32(value, ok).toLong()
+        GblnValueType.I64 -> lib.gbln_value_as_i64(value, ok)
+        GblnValueType.U8 -> lib.gbln_value_as_u8(value, ok).toLong()
+        GblnValueType.U16 -> lib.gbln_value_as_u16(value, ok).toLong()
+        GblnValueType.U32 -> lib.gbln_value_as_u32(value, ok)
+        GblnValueType.U64 -> lib.gbln_value_as_u64(value, ok)
+        else -> throw ValidationError("Expected integer value, found ${GblnValueType.nameOf(valueType)}")
+    }
+    if (ok[0] == 0.toByte()) {
+        throw ValidationError("Failed to extract ${GblnValueType.nameOf(valueType)} value")
+    }
+    return result
+}
+
+/**
+ * Read a float value of either width as Double, without boxing.
+ *
+ * @throws ValidationError if the value is not a float
+ */
+internal fun readDouble(value: Pointer, valueType: Int): Double {
+    val ok = ByteArray(1)
+    val result = when (valueType) {
+        GblnValueType.F32 -> lib.gbln_value_as_f32(value, ok).toDouble()
+        GblnValueType.F64 -> lib.gbln_value_as_f64(value, ok)
+        else -> throw ValidationError("Expected float value, found ${GblnValueType.nameOf(valueType)}")
+    }
+    if (ok[0] == 0.toByte()) {
+        throw ValidationError("Failed to extract ${GblnValueType.nameOf(valueType)} value")
+    }
+    return result
+}
+
+/**
+ * Read a bool value.
+ *
+ * @throws ValidationError if the value is not a bool
+ */
+internal fun readBoolean(value: Pointer, valueType: Int): Boolean {
+    if (valueType != GblnValueType.BOOL) {
+        throw ValidationError("Expected bool value, found ${GblnValueType.nameOf(valueType)}")
+    }
+    val ok = ByteArray(1)
+    val result = lib.gbln_value_as_bool(value, ok)
+    if (ok[0] == 0.toByte()) {
+        throw ValidationError("Failed to extract bool value")
+    }
+    return result != 0.toByte()
+}
+
+/**
+ * Read a string value.
+ *
+ * @throws ValidationError if the value is not a string
+ */
+internal fun readString(value: Pointer, valueType: Int): String {
+    if (valueType != GblnValueType.STRING) {
+        throw ValidationError("Expected string value, found ${GblnValueType.nameOf(valueType)}")
+    }
+    val ok = ByteArray(1)
+    val strPtr = lib.gbln_value_as_string(value, ok)
+    if (ok[0] == 0.toByte()) {
+        throw ValidationError("Failed to extract string value")
+    }
+    // NOTE: String is owned by the Value - don't free
+    return if (strPtr != null && Pointer.nativeValue(strPtr) != 0L) StringValues.read(strPtr, dedup = false) else ""
+}
+
+/**
+ * Read the keys of an object value, in document order.
+ *
+ * Keys go through the KeyInterner, so repeated keys are neither decoded
+ * nor allocated again. The array returned by gbln_object_keys belongs to
+ * the caller, but libgbln allocates it itself, so it is handed back to
+ * gbln_keys_free whether or not reading succeeds. With a libgbln that
+ * does not export gbln_keys_free the keys are leaked: releasing them with
+ * another allocator's free could corrupt the heap.
+ */
+internal fun readObjectKeys(value: Pointer): Array<String> {
+    val countRef = com.sun.jna.ptr.LongByReference()
+    val keysPtr = lib.gbln_object_keys(value, countRef)
+    if (keysPtr == null || Pointer.nativeValue(keysPtr) == 0L) {
+        return emptyArray()
+    }
+
+    val count = countRef.value.toInt()
+    try {
+        val keyPtrs = keysPtr.getPointerArray(0, count)
+        return Array(count) { i ->
+            val keyPtr = keyPtrs[i] ?: throw ValidationError("Null key in object")
+            KeyInterner.intern(keyPtr)
+        }
+    } finally {
+        keysFree?.invokeVoid(arrayOf(keysPtr, count.toLong()))
+    }
+}
+
+/**
+ * gbln_keys_free(keys, count), or null if this libgbln does not export it.
+ * Looked up by name rather than bound, so older builds still load.
+ */
+private val keysFree: Function? by lazy {
+    try {
+        NativeLibrary.getInstance(libraryName).getFunction("gbln_keys_free")
+    } catch (e: UnsatisfiedLinkError) {
+        null
+    }
+}
+
+/**
+ * HashMap capacity that holds [count] entries without rehashing.
+ */
+internal fun mapCapacity(count: Int): Int =
+    if (count < 3) count + 1 else (count / 0.75f + 1.0f).toInt()
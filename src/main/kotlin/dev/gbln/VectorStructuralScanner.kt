@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import jdk.incubator.vector.ByteVector
+import jdk.incubator.vector.VectorSpecies
+
+/**
+ * StructuralScanner on jdk.incubator.vector, classifying 32 or 64 bytes
+ * per step (64 where the CPU has 512-bit vectors).
+ *
+ * Only loaded through structuralScanner, which checks that the module is
+ * present first; referencing this class directly without
+ * `--add-modules jdk.incubator.vector` fails with NoClassDefFoundError.
+ */
+internal object VectorStructuralScanner : StructuralScanner() {
+
+    private val SPECIES: VectorSpecies<Byte> =
+        if (ByteVector.SPECIES_PREFERRED.vectorBitSize() >= 512) ByteVector.SPECIES_512 else ByteVector.SPECIES_256
+
+    // Clearing bit 5 folds '{' '}' onto '[' ']'; clearing bit 0 folds ')'
+    // onto '('. Seven compares then cover all ten bytes, with no other
+    // byte folding onto a compared value.
+    private const val CASE_MASK: Byte = 0xDF.toByte()
+    private const val PAREN_MASK: Byte = 0xFE.toByte()
+
+    override val name: String get() = "vector${SPECIES.length() * 8}"
+
+    override fun scan(input: ByteArray, from: Int, to: Int): StructuralIndex {
+        val index = StructuralIndex(StructuralScanner.capacityFor(to - from))
+        val step = SPECIES.length()
+        val bound = from + SPECIES.loopBound(to - from)
+
+        var i = from
+        while (i < bound) {
+            val v = ByteVector.fromArray(SPECIES, input, i)
+            val folded = v.and(CASE_MASK)
+            val mask = folded.eq('['.code.toByte())
+                .or(folded.eq(']'.code.toByte()))
+                .or(v.and(PAREN_MASK).eq('('.code.toByte()))
+                .or(v.eq('<'.code.toByte()))
+                .or(v.eq('>'.code.toByte()))
+                .or(v.eq('\\'.code.toByte()))
+                .or(v.eq(':'.code.toByte()))
+
+            var bits = mask.toLong()
+            while (bits != 0L) {
+                index.add(i + java.lang.Long.numberOfTrailingZeros(bits))
+                bits = bits and (bits - 1)
+            }
+            i += step
+        }
+
+        ScalarStructuralScanner.scanInto(index, input, i, to)
+        return index
+    }
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import jdk.incubator.vector.ByteVector
+import jdk.incubator.vector.VectorOperators
+import jdk.incubator.vector.VectorSpecies
+
+/**
+ * Utf8Counter on jdk.incubator.vector: the lookup-table validator of
+ * Keiser and Lemire ("Validating UTF-8 in less than one instruction per
+ * byte"), 32 or 64 bytes per step. Each byte pair is classified by three
+ * 16-entry tables indexed by nibbles of the previous and current byte;
+ * the AND of the three is non-zero only for invalid pairs, except where
+ * a third or fourth byte must be a continuation. All-ASCII blocks skip
+ * the tables. Code points are the bytes that are not continuations.
+ *
+ * Only loaded through utf8Counter, which checks that the module is
+ * present first (see VectorStructuralScanner).
+ */
+internal object VectorUtf8Counter : Utf8Counter() {
+
+    private val SPECIES: VectorSpecies<Byte> =
+        if (ByteVector.SPECIES_PREFERRED.vectorBitSize() >= 512) ByteVector.SPECIES_512 else ByteVector.SPECIES_256
+
+    // Error classes of a (previous, current) byte pair
+    private const val TOO_SHORT = 0x01 // lead or ASCII, then lead or ASCII where a continuation is due
+    private const val TOO_LONG = 0x02 // ASCII, then continuation
+    private const val OVERLONG_3 = 0x04 // E0 80..9F
+    private const val TOO_LARGE = 0x08 // above U+10FFFF
+    private const val SURROGATE = 0x10 // ED A0..BF
+    private const val OVERLONG_2 = 0x20 // C0, C1
+    private const val TOO_LARGE_1000 = 0x40 // F5..FF 80..8F
+    private const val OVERLONG_4 = 0x40 // F0 80..8F
+    private const val TWO_CONTS = 0x80 // continuation, then continuation
+    private const val CARRY = TOO_SHORT or TOO_LONG or TWO_CONTS
+
+    private val BYTE_1_HIGH = table(
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+        TOO_SHORT or OVERLONG_2,
+        TOO_SHORT,
+        TOO_SHORT or OVERLONG_3 or SURROGATE,
+        TOO_SHORT or TOO_LARGE or TOO_LARGE_1000 or OVERLONG_4
+    )
+
+    private val BYTE_1_LOW = table(
+        CARRY or OVERLONG_3 or OVERLONG_2 or OVERLONG_4,
+        CARRY or OVERLONG_2,
+        CARRY,
+        CARRY,
+        CARRY or TOO_LARGE,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000 or SURROGATE,
+        CARRY or TOO_LARGE or TOO_LARGE_1000,
+        CARRY or TOO_LARGE or TOO_LARGE_1000
+    )
+
+    private val BYTE_2_HIGH = table(
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_LONG or OVERLONG_2 or TWO_CONTS or OVERLONG_3 or TOO_LARGE_1000 or OVERLONG_4,
+        TOO_LONG or OVERLONG_2 or TWO_CONTS or OVERLONG_3 or TOO_LARGE,
+        TOO_LONG or OVERLONG_2 or TWO_CONTS or SURROGATE or TOO_LARGE,
+        TOO_LONG or OVERLONG_2 or TWO_CONTS or SURROGATE or TOO_LARGE,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+    )
+
+    // A block ends inside a sequence if one of its last three bytes is a
+    // lead byte needing more bytes than remain
+    private val INCOMPLETE_MAX = ByteVector.fromArray(
+        SPECIES,
+        ByteArray(SPECIES.length()) { -1 }.also {
+            val n = it.size
+            it[n - 3] = (0xF0 - 1).toByte()
+            it[n - 2] = (0xE0 - 1).toByte()
+            it[n - 1] = (0xC0 - 1).toByte()
+        },
+        0
+    )
+
+    /** Bytes below this (signed) are continuations, 0x80..0xBF. */
+    private const val FIRST_LEAD: Byte = -64
+
+    override val name: String get() = "vector${SPECIES.length() * 8}"
+
+    override fun count(bytes: ByteArray, from: Int, to: Int): Int {
+        val step = SPECIES.length()
+        val zero = ByteVector.zero(SPECIES)
+        var previous = zero
+        var errors = zero
+        var incomplete = false
+        var continuations = 0
+
+        var i = from
+        while (i < to) {
+            // The last block is zero-padded: ASCII, so a sequence cut off
+            // by the end of the range shows up as TOO_SHORT
+            val input = if (to - i >= step) {
+                ByteVector.fromArray(SPECIES, bytes, i)
+            } else {
+                ByteVector.fromArray(SPECIES, bytes, i, SPECIES.indexInRange(i, to))
+            }
+
+            if (!input.lt(0.toByte()).anyTrue()) {
+                if (incomplete) return -1
+            } else {
+                errors = errors.or(check(input, previous))
+                incomplete = input.compare(VectorOperators.UNSIGNED_GT, INCOMPLETE_MAX).anyTrue()
+                continuations += input.lt(FIRST_LEAD).trueCount()
+            }
+            previous = input
+            i += step
+        }
+
+        if (incomplete || errors.compare(VectorOperators.NE, 0.toByte()).anyTrue()) {
+            return -1
+        }
+        return to - from - continuations
+    }
+
+    /** Non-zero lanes where the pair ending at that lane is invalid. */
+    private fun check(input: ByteVector, previous: ByteVector): ByteVector {
+        val step = SPECIES.length()
+        val prev1 = previous.slice(step - 1, input)
+        val special = prev1.lanewise(VectorOperators.LSHR, 4).selectFrom(BYTE_1_HIGH)
+            .and(prev1.and(0x0F.toByte()).selectFrom(BYTE_1_LOW))
+            .and(input.lanewise(VectorOperators.LSHR, 4).selectFrom(BYTE_2_HIGH))
+
+        // Two continuations in a row are fine only as the third or fourth
+        // byte of a sequence; flip TWO_CONTS there
+        val prev2 = previous.slice(step - 2, input)
+        val prev3 = previous.slice(step - 3, input)
+        val mustContinue = prev2.compare(VectorOperators.UNSIGNED_GE, 0xE0.toByte())
+            .or(prev3.compare(VectorOperators.UNSIGNED_GE, 0xF0.toByte()))
+        return special.lanewise(VectorOperators.XOR, ByteVector.zero(SPECIES).blend(TWO_CONTS.toByte(), mustContinue))
+    }
+
+    /** A 16-entry lookup table repeated across the species. */
+    private fun table(vararg entries: Int): ByteVector {
+        require(entries.size == 16)
+        return ByteVector.fromArray(SPECIES, ByteArray(SPECIES.length()) { entries[it and 15].toByte() }, 0)
+    }
+}
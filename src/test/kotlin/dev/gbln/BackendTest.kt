@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+
+/**
+ * Checks of whichever FFI backend is loaded. The testPanama task runs the
+ * suite again with -Dgbln.backend=panama.
+ */
+class BackendTest {
+
+    private val input = "user{name<s16>(Größe 日本) id<u32>(7) tags<s8>[a b] ratio<f64>(0.5) none<n>()}"
+
+    @Test
+    fun `test requested backend is in use`() {
+        val requested = GblnBackend.requested() ?: return
+        assertEquals(requested, gblnBackend)
+    }
+
+    @Test
+    fun `test backend converts and serialises values`() {
+        val expected = mapOf(
+            "user" to mapOf("name" to "Größe 日本", "id" to 7L, "tags" to listOf("a", "b"), "ratio" to 0.5, "none" to null)
+        )
+        assertEquals(expected, parse(input))
+
+        parseRaw(input).use { value ->
+            val text = dev.gbln.toString(value)
+            assertTrue("Größe 日本" in text, text)
+            assertEquals(expected, parse(text))
+        }
+    }
+
+    @Test
+    fun `test backend reports error messages`() {
+        val error = assertFailsWith<ParseError> { parse("a<i8>(300)") }
+        assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, error.code)
+        assertTrue(error.message!!.isNotEmpty())
+    }
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class DocumentTest {
+
+    private fun document(input: String): GblnDocument = GblnDocument.parse(input, GblnEngine.JVM)
+
+    @Test
+    fun `test cursor navigation and unboxed getters`() {
+        val doc = document(
+            """
+            users[{id<u32>(1) name<s8>(Alice)} {id<u32>(2) name<s8>(Bøb)}]
+            scores[<f32>(1.5) <f64>(2.25)]
+            active<b>(t)
+            """
+        )
+
+        val root = doc.root
+        assertEquals(listOf("users", "scores", "active"), root.keys)
+        assertEquals(2L, root["users"][1]["id"].asLong())
+        assertEquals("Bøb", root["users"][1]["name"].asString())
+        assertEquals(1.5, root["scores"][0].asDouble())
+        assertEquals(2.25, root["scores"][1].asDouble())
+        assertTrue(root["active"].asBoolean())
+        assertNull(root.getOrNull("missing"))
+        assertEquals("name", root["users"][0]["name"].key)
+    }
+
+    @Test
+    fun `test repeated keys share one pool entry`() {
+        val doc = document("r[{id<u32>(1) name<s8>(a)} {id<u32>(2) name<s8>(b)} {id<u32>(3) name<s8>(c)}]")
+
+        // Three keys plus three string values
+        assertEquals(6, doc.offsets.size - 1)
+        assertEquals(11, doc.nodeCount)
+    }
+
+    @Test
+    fun `test toKotlin converts every type`() {
+        val doc = document("u8s<u8>[95 87 255] big<u64>(18446744073709551615) none<n>()")
+
+        assertEquals(mapOf("u8s" to listOf(95, 87, 255), "big" to -1L, "none" to null), doc.root.toKotlin())
+
+        val options = GblnParseOptions(primitiveArrays = true)
+        val data = doc.root.toKotlin(options) as Map<*, *>
+        assertContentEquals(shortArrayOf(95, 87, 255), data["u8s"] as ShortArray)
+    }
+
+    @Test
+    fun `test cursor keeps string bounds and typed array hints`() {
+        val doc = document("name<s16>(Alice) tags<s8>[] ids<u16>[] plain[] n<i32>(1)")
+        val root = doc.root
+
+        assertEquals(16, root["name"].maxLength)
+        assertEquals(GblnValueType.STRING, root["tags"].elementType)
+        assertEquals(8, root["tags"].maxLength)
+        assertEquals(GblnValueType.U16, root["ids"].elementType)
+        assertEquals(-1, root["plain"].elementType)
+        assertEquals(-1, root["n"].maxLength)
+    }
+
+    @Test
+    fun `test type mismatch throws ValidationError`() {
+        val doc = document("x[<s8>(x)]")
+
+        assertFailsWith<ValidationError> { doc.root["x"][0].asLong() }
+        assertFailsWith<ValidationError> { doc.root["x"]["x"] }
+        assertFailsWith<IndexOutOfBoundsException> { doc.root["x"][1] }
+    }
+
+    @Test
+    fun `test shared tape view converts like a copy`() {
+        val bytes = "r[{id<u32>(1) name<s8>(a)} {id<u32>(2) name<s8>(b)}] f<f64>[0.5 1.5]".toByteArray()
+        val copy = JvmParser(bytes).parse()
+        val view = JvmParser(bytes, tape = TapeBuilder()).parse(shared = true)
+
+        assertEquals(copy.nodeCount, view.nodeCount)
+        assertEquals(copy.root.toKotlin(), view.root.toKotlin())
+        assertEquals(listOf("r", "f"), view.root.keys)
+    }
+
+    @Test
+    fun `test parse into document`() {
+        val doc = GblnDocument.parse("a<i32>(1) b<s8>(hi)")
+
+        assertEquals(1L, doc.root["a"].asLong())
+        assertEquals("hi", doc.root["b"].asString())
+        assertEquals(mapOf("a" to 1, "b" to "hi"), doc.root.toKotlin())
+    }
+}
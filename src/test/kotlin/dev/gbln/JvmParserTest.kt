@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import java.nio.ByteBuffer
+import java.nio.file.Paths
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertIs
+import kotlin.test.assertTrue
+
+class JvmParserTest {
+
+    private val jvm = GblnParseOptions(engine = GblnEngine.JVM)
+    private val native = GblnParseOptions(engine = GblnEngine.NATIVE)
+
+    private val fixtures = listOf(
+        "/valid_simple.gbln",
+        "/valid_nested.gbln",
+        "/valid_array.gbln",
+        "/fixtures/valid/simple.gbln",
+        "/fixtures/valid/nested.gbln",
+        "/fixtures/valid/array.gbln",
+        "/fixtures/valid/types.gbln"
+    )
+
+    private fun code(input: String, options: GblnParseOptions): Int =
+        assertFailsWith<ParseError> { parse(input, options) }.code
+
+    @Test
+    fun `test JVM engine matches native on fixtures`() {
+        for (fixture in fixtures) {
+            val path = Paths.get(javaClass.getResource(fixture)!!.toURI())
+            assertEquals(parseFile(path, native), parseFile(path, jvm), fixture)
+        }
+    }
+
+    @Test
+    fun `test JVM engine matches native error codes`() {
+        for (fixture in listOf("/invalid_syntax.gbln", "/invalid_type.gbln")) {
+            val text = javaClass.getResource(fixture)!!.readText()
+            assertEquals(code(text, native), code(text, jvm), fixture)
+        }
+        for (input in listOf("a<i8>(1) a<i8>(2)", "a<s4>(hello)", "a<x9>(1)", "a<u8>(-1)", "a<i32>(12x)")) {
+            assertEquals(code(input, native), code(input, jvm), input)
+        }
+    }
+
+    @Test
+    fun `test integer ranges`() {
+        assertEquals(mapOf("a" to -128, "b" to 255), parse("a<i8>(-128) b<u8>(255)", jvm))
+        assertEquals(Long.MIN_VALUE, (parse("a<i64>(-9223372036854775808) b<n>()", jvm) as Map<*, *>)["a"])
+        assertEquals(-1L, (parse("a<u64>(18446744073709551615) b<n>()", jvm) as Map<*, *>)["a"])
+
+        for (input in listOf("a<i8>(128)", "a<i8>(-129)", "a<u16>(65536)", "a<u64>(18446744073709551616)", "a<u8>(-1)")) {
+            assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, code(input, jvm), input)
+        }
+        assertEquals(GblnErrorCode.ERROR_TYPE_MISMATCH, code("a<i32>(1.5)", jvm))
+    }
+
+    @Test
+    fun `test string bounds count characters`() {
+        val result = parse("a<s4>(äöüß) b<s2>()", jvm) as Map<*, *>
+        assertEquals("äöüß", result["a"])
+        assertEquals(GblnErrorCode.ERROR_STRING_TOO_LONG, code("a<s4>(abcde)", jvm))
+        assertEquals(GblnErrorCode.ERROR_INVALID_TYPE_HINT, code("a<s3>(abc)", jvm))
+    }
+
+    @Test
+    fun `test comments, objects and arrays`() {
+        val input = """
+            :| header
+            user{
+                id<u32>(7) :| trailing
+                tags<s8>[a b]
+                items[{n<i8>(1)} {n<i8>(2)}]
+            }
+            ok<b>(t)
+        """.trimIndent()
+
+        val result = parse(input, jvm) as Map<*, *>
+        assertEquals(
+            mapOf("id" to 7L, "tags" to listOf("a", "b"), "items" to listOf(mapOf("n" to 1), mapOf("n" to 2))),
+            result["user"]
+        )
+        assertEquals(true, result["ok"])
+    }
+
+    @Test
+    fun `test duplicate keys are rejected at every size`() {
+        val small = "o{a<i8>(1) a<i8>(2)}"
+        val large = "o{" + (0 until 40).joinToString(" ") { "k$it<i8>(1)" } + " k39<i8>(2)}"
+        assertEquals(GblnErrorCode.ERROR_DUPLICATE_KEY, code(small, jvm))
+        assertEquals(GblnErrorCode.ERROR_DUPLICATE_KEY, code(large, jvm))
+    }
+
+    @Test
+    fun `test errors report line and column`() {
+        val error = assertFailsWith<ParseError> { parse("a<i8>(1)\nb<i8>(300)", jvm) }
+        assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, error.code)
+        assertTrue(error.message!!.contains("line 2"), error.message)
+    }
+
+    @Test
+    fun `test byte, buffer, tryParse and document entry points`() {
+        val bytes = "xx a<i32>(1) b<s8>(hi)".toByteArray()
+        val expected = mapOf("a" to 1, "b" to "hi")
+
+        assertEquals(expected, parse(bytes, 3, bytes.size - 3, jvm))
+        assertEquals(expected, parse(ByteBuffer.wrap(bytes, 3, bytes.size - 3), jvm))
+        assertEquals(expected, parse(ByteBuffer.allocateDirect(bytes.size).put(bytes).flip().position(3), jvm))
+        assertEquals(expected, tryParse("a<i32>(1) b<s8>(hi)", jvm).getOrThrow())
+        assertIs<GblnParseResult.Failure>(tryParse("a<i8>(999)", jvm))
+
+        val document = GblnDocument.parse("a<i32>(1) b<s8>(hi)", GblnEngine.JVM)
+        assertEquals(1L, document.root["a"].asLong())
+        assertEquals(expected, document.root.toKotlin())
+    }
+}
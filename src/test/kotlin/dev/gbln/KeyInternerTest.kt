@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Memory
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNotSame
+import kotlin.test.assertSame
+
+class KeyInternerTest {
+
+    private fun nativeString(value: String): Memory {
+        val bytes = value.toByteArray(Charsets.UTF_8)
+        return Memory(bytes.size + 1L).apply {
+            write(0, bytes, 0, bytes.size)
+            setByte(bytes.size.toLong(), 0)
+        }
+    }
+
+    @Test
+    fun `test repeated keys return the same instance`() {
+        val bytes = "xxnamexx".toByteArray()
+        val first = KeyInterner.intern(bytes, 2, 4)
+
+        assertEquals("name", first)
+        assertSame(first, KeyInterner.intern("name".toByteArray(), 0, 4))
+    }
+
+    @Test
+    fun `test native and heap lookups share entries`() {
+        val heap = KeyInterner.intern("größe".toByteArray(), 0, "größe".toByteArray().size)
+
+        nativeString("größe").use { assertSame(heap, KeyInterner.intern(it)) }
+        nativeString("").use { assertEquals("", KeyInterner.intern(it)) }
+    }
+
+    @Test
+    fun `test long keys are decoded but not cached`() {
+        val key = "k".repeat(KeyInterner.MAX_KEY_BYTES + 1)
+        val bytes = key.toByteArray()
+
+        val first = KeyInterner.intern(bytes, 0, bytes.size)
+        assertEquals(key, first)
+        assertNotSame(first, KeyInterner.intern(bytes, 0, bytes.size))
+        nativeString(key).use { assertEquals(key, KeyInterner.intern(it)) }
+    }
+}
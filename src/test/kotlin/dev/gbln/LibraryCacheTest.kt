@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.AfterEach
+import org.junit.jupiter.api.BeforeEach
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.io.TempDir
+import java.nio.file.FileSystems
+import java.nio.file.Files
+import java.nio.file.Path
+import java.nio.file.attribute.PosixFilePermissions
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class LibraryCacheTest {
+
+    @TempDir
+    lateinit var cacheDir: Path
+
+    @BeforeEach
+    fun setUp() {
+        System.setProperty("gbln.cacheDir", cacheDir.toString())
+    }
+
+    @AfterEach
+    fun tearDown() {
+        System.clearProperty("gbln.cacheDir")
+    }
+
+    @Test
+    fun `test first extraction writes and later ones hit the cache`() {
+        val first = assertNotNull(LibraryCache.extract("/native/test/libfake.bin", "libfake.bin"))
+        assertFalse(first.hit)
+        assertTrue(first.path.startsWith(cacheDir))
+        assertEquals("not a real library\n", Files.readString(first.path))
+
+        val second = assertNotNull(LibraryCache.extract("/native/test/libfake.bin", "libfake.bin"))
+        assertTrue(second.hit)
+        assertEquals(first.path, second.path)
+    }
+
+    @Test
+    fun `test directory is named by content hash`() {
+        val entry = assertNotNull(LibraryCache.extract("/native/test/libfake.bin", "libfake.bin"))
+
+        val hash = entry.path.parent.fileName.toString()
+        assertEquals(64, hash.length)
+        assertEquals("v1", entry.path.parent.parent.fileName.toString())
+        // No temp files left behind
+        assertEquals(listOf(".lock", "libfake.bin"), Files.list(entry.path.parent).use { s -> s.map { it.fileName.toString() }.sorted().toList() })
+    }
+
+    @Test
+    fun `test tampered copy in a shared cache is replaced, not loaded`() {
+        if (!FileSystems.getDefault().supportedFileAttributeViews().contains("posix")) return
+        val first = assertNotNull(LibraryCache.extract("/native/test/libfake.bin", "libfake.bin"))
+        // A group-writable directory is no longer trusted by name
+        Files.setPosixFilePermissions(first.path.parent, PosixFilePermissions.fromString("rwxrwx---"))
+        Files.writeString(first.path, "replaced by someone else\n")
+
+        val second = assertNotNull(LibraryCache.extract("/native/test/libfake.bin", "libfake.bin"))
+        assertFalse(second.hit)
+        assertEquals(first.path, second.path)
+        assertEquals("not a real library\n", Files.readString(second.path))
+    }
+
+    @Test
+    fun `test missing resource returns null`() {
+        assertNull(LibraryCache.extract("/native/test/libmissing.so", "libmissing.so"))
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class LifetimeTest {
+
+    @Test
+    fun `test close is idempotent`() {
+        val value = parseRaw("user{id<u32>(1)}")
+        assertFalse(value.isClosed)
+
+        value.close()
+        value.close()
+
+        assertTrue(value.isClosed)
+    }
+
+    @Test
+    fun `test ptr access after close throws`() {
+        val value = parseRaw("user{id<u32>(1)}")
+        value.close()
+
+        assertFailsWith<IllegalStateException> { value.ptr }
+        assertFailsWith<IllegalStateException> { toString(value) }
+    }
+
+    @Test
+    fun `test use closes value`() {
+        val value = parseRaw("config{debug<b>(t)}")
+        val text = value.use { toString(it) }
+
+        assertTrue(text.contains("debug<b>"))
+        assertTrue(value.isClosed)
+    }
+
+    @Test
+    fun `test arena closes all owned values`() {
+        val arena = GblnArena()
+        val values = (1..10).map { arena.parseRaw("item{id<u32>($it)}") }
+        val bytesValue = arena.parseRaw("item{id<u32>(11)}".toByteArray())
+
+        assertFalse(values.any { it.isClosed })
+
+        arena.close()
+        arena.close()
+
+        assertTrue(values.all { it.isClosed })
+        assertTrue(bytesValue.isClosed)
+    }
+
+    @Test
+    fun `test closed arena rejects new values`() {
+        val arena = GblnArena()
+        arena.close()
+
+        assertFailsWith<IllegalStateException> { arena.parseRaw("item{id<u32>(1)}") }
+    }
+}
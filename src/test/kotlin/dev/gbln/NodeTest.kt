@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNull
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class NodeTest {
+
+    // Several top-level fields, so the root is the document object
+    private val input = "database{host<s64>(localhost)port<u16>(5432)}" +
+        "tags<s16>[alpha beta]ratio<f32>(0.5)debug<b>(t)missing<n>()"
+
+    @Test
+    fun `test navigate nested fields`() {
+        parseRaw(input).use { value ->
+            val config = value.node()
+            assertEquals(5432L, config["database"]["port"].asLong())
+            assertEquals(5432, config["database"]["port"].asInt())
+            assertEquals("localhost", config["database"]["host"].asString())
+            assertEquals(0.5, config["ratio"].asDouble(), 0.0001)
+            assertTrue(config["debug"].asBoolean())
+            assertTrue(config["missing"].isNull)
+        }
+    }
+
+    @Test
+    fun `test size keys and iteration`() {
+        parseRaw(input).use { value ->
+            val config = value.node()
+            assertEquals(listOf("database", "tags", "ratio", "debug", "missing"), config.keys)
+            assertEquals(5, config.size)
+            assertEquals(listOf("alpha", "beta"), config["tags"].map { it.asString() })
+            assertEquals("beta", config["tags"][1].asString())
+        }
+    }
+
+    @Test
+    fun `test child lookups are cached`() {
+        parseRaw(input).use { value ->
+            val root = value.node()
+            assertSame(root["database"], root["database"])
+        }
+    }
+
+    @Test
+    fun `test missing key and wrong type`() {
+        parseRaw(input).use { value ->
+            val config = value.node()
+            assertNull(config.getOrNull("nope"))
+            assertFailsWith<ValidationError> { config["nope"] }
+            assertFailsWith<ValidationError> { config["debug"].asLong() }
+            assertFailsWith<IndexOutOfBoundsException> { config["tags"][2] }
+        }
+    }
+
+    @Test
+    fun `test subtree conversion`() {
+        parseRaw(input).use { value ->
+            @Suppress("UNCHECKED_CAST")
+            val database = value.node()["database"].toKotlin() as Map<String, Any?>
+            assertEquals("localhost", database["host"])
+        }
+    }
+
+    @Test
+    fun `test node access after close throws`() {
+        val value = parseRaw(input)
+        val config = value.node()
+        value.close()
+
+        assertFailsWith<IllegalStateException> { config["database"] }
+    }
+}
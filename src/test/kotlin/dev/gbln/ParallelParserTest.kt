@@ -0,0 +1,119 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertIs
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class ParallelParserTest {
+
+    private val jvm = GblnParseOptions(engine = GblnEngine.JVM)
+
+    private fun parallel(input: String, options: GblnParseOptions = jvm): Any? {
+        val bytes = input.toByteArray()
+        return ParallelParser.parse(bytes, 0, bytes.size, options, threshold = 0, minChunk = 64)
+    }
+
+    private fun sequential(input: String, options: GblnParseOptions = jvm): Any? = parse(input, options)
+
+    private fun records(count: Int) = buildString {
+        append("meta{v<i8>(1)} :| header ( ] }\nusers[\n")
+        for (i in 0 until count) {
+            append("  {id<u32>(").append(i).append(") name<s32>(u\\)").append(i).append(") tags<s8>[a (b ]c)]}")
+            if (i % 7 == 0) append(" :| note { [\n")
+            append('\n')
+        }
+        append("]\nfooter<s8>(end)")
+    }
+
+    @Test
+    fun `test large array matches sequential parse`() {
+        val input = records(500)
+        assertEquals(sequential(input), parallel(input))
+        assertEquals(
+            sequential(input, jvm.copy(compactObjects = true)),
+            parallel(input, jvm.copy(compactObjects = true))
+        )
+    }
+
+    @Test
+    fun `test compact records share shapes within a chunk`() {
+        val bytes = records(500).toByteArray()
+        val options = jvm.copy(compactObjects = true)
+        // At most four chunks
+        val data = ParallelParser.parse(bytes, 0, bytes.size, options, threshold = 0, minChunk = bytes.size / 4)
+        val users = (data as Map<*, *>)["users"] as List<*>
+        val shapes = users.map { assertIs<ShapedMap>(it).shape }.toSet()
+
+        // One shape per chunk, not one per record
+        assertTrue(shapes.size <= 4, "${shapes.size} shapes")
+    }
+
+    @Test
+    fun `test planner splits between elements`() {
+        val bytes = records(500).toByteArray()
+        val index = ScalarStructuralScanner.scan(bytes, 0, bytes.size)
+        val plan = assertNotNull(SplitPlanner(bytes, 0, bytes.size, index).plan(8))
+
+        assertTrue(plan.array)
+        assertEquals('['.code.toByte(), bytes[plan.open])
+        assertTrue(plan.splits.size > 2)
+        for (split in plan.splits.drop(1).dropLast(1)) {
+            assertEquals('}'.code.toByte(), bytes[split - 1], "split at $split")
+        }
+    }
+
+    @Test
+    fun `test top-level members and objects`() {
+        val members = (0 until 400).joinToString("\n") { "k$it{v<i32>($it) s<s16>(x)}" }
+        assertEquals(sequential(members), parallel(members))
+
+        val bare = "{$members}"
+        assertEquals(sequential(bare), parallel(bare))
+    }
+
+    @Test
+    fun `test primitive arrays join into one array`() {
+        val ints = "values[" + (0 until 2000).joinToString(" ") { "<i32>($it)" } + "]"
+        val options = jvm.copy(primitiveArrays = true)
+        val expected = (sequential(ints, options) as Map<*, *>)["values"]
+        val actual = (parallel(ints, options) as Map<*, *>)["values"]
+        assertIs<IntArray>(actual)
+        assertContentEquals(expected as IntArray, actual)
+
+        val mixed = "values[" + (0 until 2000).joinToString(" ") { if (it == 1500) "<i64>($it)" else "<i32>($it)" } + "]"
+        assertEquals(sequential(mixed, options), parallel(mixed, options))
+    }
+
+    @Test
+    fun `test errors match sequential parse`() {
+        val members = (0 until 400).joinToString(" ") { "k$it<i32>($it)" }
+        for (input in listOf("$members k3<i8>(1)", records(300).replace("(250)", "(x250)"), records(300) + "}")) {
+            val expected = assertFailsWith<ParseError> { sequential(input) }
+            val actual = assertFailsWith<GblnSyntaxException> { parallel(input) }
+            assertEquals(expected.code, actual.code)
+            assertEquals(expected.message, actual.message)
+        }
+    }
+
+    @Test
+    fun `test typed arrays are not split`() {
+        val bytes = ("ids<u32>[" + (0 until 5000).joinToString(" ") + "]").toByteArray()
+        val index = ScalarStructuralScanner.scan(bytes, 0, bytes.size)
+        assertNull(SplitPlanner(bytes, 0, bytes.size, index).plan(8))
+        assertEquals(sequential(String(bytes)), parallel(String(bytes)))
+    }
+
+    @Test
+    fun `test parallel option through parse`() {
+        val input = records(50)
+        assertEquals(sequential(input), parse(input, jvm.copy(parallel = true)))
+    }
+}
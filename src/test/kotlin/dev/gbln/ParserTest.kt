@@ -16,8 +16,10 @@
 
 package dev.gbln
 
+import java.nio.ByteBuffer
 import kotlin.test.Test
 import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
 
 class ParserTest {
 
@@ -41,4 +43,39 @@ class ParserTest {
         }
         assertEquals(true, loaded, "Library should load successfully")
     }
+
+    @Test
+    fun testParseBytesMatchesString() {
+        val input = "user{id<u32>(12345)name<s64>(Größe)}"
+        val padded = ("xx" + input + "yy").toByteArray(Charsets.UTF_8)
+        val bytes = input.toByteArray(Charsets.UTF_8)
+
+        assertEquals(parse(input), parse(bytes))
+        assertEquals(parse(input), parse(padded, 2, bytes.size))
+    }
+
+    @Test
+    fun testParseByteBuffers() {
+        val input = "config{debug<b>(t)workers<u8>(8)}"
+        val bytes = input.toByteArray(Charsets.UTF_8)
+        val expected = parse(input)
+
+        // Heap buffer
+        assertEquals(expected, parse(ByteBuffer.wrap(bytes)))
+
+        // Direct buffer without terminator (copied)
+        val direct = ByteBuffer.allocateDirect(bytes.size).put(bytes).flip()
+        assertEquals(expected, parse(direct))
+
+        // Direct buffer with terminator past the limit (zero-copy)
+        val terminated = ByteBuffer.allocateDirect(bytes.size + 1).put(bytes).put(0.toByte()).flip()
+        terminated.limit(bytes.size)
+        assertEquals(expected, parse(terminated))
+        assertEquals(0, terminated.position())
+    }
+
+    @Test
+    fun testParseBytesRejectsBadRange() {
+        assertFailsWith<IndexOutOfBoundsException> { parseRaw(ByteArray(4), 3, 2) }
+    }
 }
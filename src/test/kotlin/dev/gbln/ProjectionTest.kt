@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.io.TempDir
+import java.nio.file.Files
+import java.nio.file.Path
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class ProjectionTest {
+
+    @TempDir
+    lateinit var tempDir: Path
+
+    private val jvm = GblnParseOptions(engine = GblnEngine.JVM)
+
+    private val wide = """
+        user{id<u32>(7) name<s16>(Ann) bio<s64>(x)}
+        config{database{host<s32>(db) port<u16>(5432)} cache{ttl<u32>(60)}}
+        users[{name<s8>(a) age<i8>(1)} {name<s8>(b) age<i8>(2)} <i8>(3)]
+    """.trimIndent()
+
+    @Test
+    fun `test projected keys keep the document shape`() {
+        val result = parse(wide, GblnProjection.of("user.id", "config.database", "users.name"))
+        assertEquals(
+            mapOf(
+                "user" to mapOf("id" to 7L),
+                "config" to mapOf("database" to mapOf("host" to "db", "port" to 5432)),
+                "users" to listOf(mapOf("name" to "a"), mapOf("name" to "b"), 3)
+            ),
+            result
+        )
+        assertEquals(mapOf("user" to mapOf<String, Any?>()), parse(wide, GblnProjection.of("user.missing")))
+        assertEquals(mapOf("user" to mapOf("id" to 7L)), parse("{$wide}", GblnProjection.of("user.id", "user.id.x")))
+    }
+
+    @Test
+    fun `test skipped members are not checked`() {
+        val input = """
+            skip{a<i8>(999) a<s2>(too long) b<s8>(} ] \) [) :| { [ (
+              c<i8>[1 (]) 300] d[{}[]]}
+            keep<i8>(1)
+        """.trimIndent()
+        assertEquals(mapOf("keep" to 1), parse(input, GblnProjection.of("keep")))
+
+        val invalidKept = assertFailsWith<ParseError> { parse("skip{x<i8>(999)} keep<i8>(999)", GblnProjection.of("keep")) }
+        assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, invalidKept.code)
+
+        for (unbalanced in listOf("skip{x[} keep<i8>(1)", "skip{x<s8>(a} keep<i8>(1)", "skip[{]")) {
+            assertFailsWith<ParseError>(unbalanced) { parse(unbalanced, GblnProjection.of("keep")) }
+        }
+    }
+
+    @Test
+    fun `test large input matches filtered full parse`() {
+        val input = buildString {
+            append("items[")
+            for (i in 0 until 5000) {
+                append("{id<u32>($i) label<s32>(item \\) $i) :| [ {\n  parts<i16>[1 2 (3)] meta{k<s8>(v)}}")
+            }
+            append("]")
+        }
+        val full = parse(input, jvm) as Map<*, *>
+        val expected = mapOf("items" to (full["items"] as List<*>).map { mapOf("id" to (it as Map<*, *>)["id"]) })
+        assertEquals(expected, parse(input, GblnProjection.of("items.id")))
+    }
+
+    @Test
+    fun `test readIo with projection`() {
+        val file = tempDir.resolve("data.io.gbln")
+        Files.writeString(file, wide)
+        assertEquals(mapOf("config" to mapOf("cache" to mapOf("ttl" to 60L))), readIo(file, GblnProjection.of("config.cache")))
+    }
+
+    @Test
+    fun `test readIo with projection on compressed file`() {
+        val file = tempDir.resolve("data.io.gbln.xz")
+        parseRaw(wide).use { writeIo(it, file) }
+        val projection = GblnProjection.of("user.id", "config.database", "users.name")
+
+        val full = readIo(file) as Map<*, *>
+        val user = full["user"] as Map<*, *>
+        val config = full["config"] as Map<*, *>
+        val users = full["users"] as List<*>
+        assertEquals(
+            mapOf(
+                "user" to mapOf("id" to user["id"]),
+                "config" to mapOf("database" to config["database"]),
+                "users" to users.map { if (it is Map<*, *>) mapOf("name" to it["name"]) else it }
+            ),
+            readIo(file, projection)
+        )
+    }
+
+    @Test
+    fun `test array indices are rejected`() {
+        assertFailsWith<IllegalArgumentException> { GblnProjection.of("users[0].name") }
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class PushParserTest {
+
+    private class Recorder : GblnPushListener {
+        val values = ArrayList<Pair<List<Any>, Any?>>()
+        val events = ArrayList<String>()
+
+        override fun onValue(path: List<Any>, value: Any?) {
+            values.add(path to value)
+        }
+
+        override fun onStartObject(path: List<Any>) {
+            events.add("{$path")
+        }
+
+        override fun onEndObject(path: List<Any>) {
+            events.add("}$path")
+        }
+
+        override fun onStartArray(path: List<Any>) {
+            events.add("[$path")
+        }
+
+        override fun onEndArray(path: List<Any>) {
+            events.add("]$path")
+        }
+    }
+
+    @Test
+    fun `test field fires as soon as it closes`() {
+        val recorder = Recorder()
+        val parser = GblnPushParser(recorder)
+
+        parser.feed("user{name<s64>(Ali")
+        assertTrue(recorder.values.isEmpty())
+        parser.feed("ce)")
+        assertEquals(listOf(listOf<Any>("user", "name") to "Alice"), recorder.values)
+
+        parser.feed(" age<i8>(4")
+        assertEquals(1, recorder.values.size)
+        parser.feed("2)}")
+        assertEquals(listOf<Any>("user", "age") to 42, recorder.values.last())
+        assertFalse(parser.isComplete)
+
+        parser.finish()
+        assertTrue(parser.isComplete)
+        assertEquals(listOf("{[]", "{[user]", "}[user]", "}[]"), recorder.events)
+    }
+
+    @Test
+    fun `test byte-at-a-time feeding matches parse`() {
+        val input = "a<s16>(hé\\)llo) :| note\nlist[{x<u8>[1 2 3]} {y<f64>(2.5)}] n<n>() t<b>(t)"
+        val bytes = input.toByteArray()
+        val recorder = Recorder()
+        val parser = GblnPushParser(recorder)
+
+        for (b in bytes) {
+            parser.feed(byteArrayOf(b))
+        }
+        parser.finish()
+
+        assertEquals(
+            listOf(
+                listOf<Any>("a") to "hé)llo",
+                listOf<Any>("list", 0, "x", 0) to 1,
+                listOf<Any>("list", 0, "x", 1) to 2,
+                listOf<Any>("list", 0, "x", 2) to 3,
+                listOf<Any>("list", 1, "y") to 2.5,
+                listOf<Any>("n") to null,
+                listOf<Any>("t") to true
+            ),
+            recorder.values
+        )
+    }
+
+    @Test
+    fun `test truncated input fails at finish`() {
+        for (input in listOf("user{name<s8>(a)", "user{name<s8>(a", "a<i8>[1 2", "a<i8")) {
+            val parser = GblnPushParser(Recorder())
+            parser.feed(input)
+            val error = assertFailsWith<ParseError>(input) { parser.finish() }
+            val expected = assertFailsWith<ParseError> { parse(input, GblnParseOptions(engine = GblnEngine.JVM)) }
+            assertEquals(expected.code, error.code, input)
+        }
+    }
+
+    @Test
+    fun `test invalid input fails without waiting for the end`() {
+        val parser = GblnPushParser(Recorder())
+        parser.feed("a<i8>(1) ")
+        val error = assertFailsWith<ParseError> { parser.feed("b<i8>(300) c<") }
+        assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, error.code)
+        assertFailsWith<IllegalStateException> { parser.feed("x") }
+    }
+
+    @Test
+    fun `test content after a closed document is rejected`() {
+        val parser = GblnPushParser(Recorder())
+        parser.feed("{a<i8>(1)}")
+        assertEquals(GblnErrorCode.ERROR_UNEXPECTED_TOKEN, assertFailsWith<ParseError> { parser.feed(" b") }.code)
+    }
+}
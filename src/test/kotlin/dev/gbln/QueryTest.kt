@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class QueryTest {
+
+    private val input = """
+        config{
+            database{host<s32>(localhost) port<u16>(5432)}
+            ratio<f64>(0.5)
+            debug<b>(t)
+        }
+        users[
+            {id<u32>(1) name<s32>(Alice)}
+            {id<u32>(2) name<s32>(Bob)}
+        ]
+    """.trimIndent()
+
+    @Test
+    fun `test compile parses keys and indices`() {
+        val path = GblnPath.compile("users[1].name")
+
+        assertEquals(listOf("users", "[1]", "name"), path.steps.map { it.toString() })
+        assertFailsWith<IllegalArgumentException> { GblnPath.compile("") }
+        assertFailsWith<IllegalArgumentException> { GblnPath.compile("a..b") }
+        assertFailsWith<IllegalArgumentException> { GblnPath.compile("a[x]") }
+        assertFailsWith<IllegalArgumentException> { GblnPath.compile("a[1]b") }
+    }
+
+    @Test
+    fun `test query extracts typed values in one pass`() {
+        val query = GblnQuery.of(
+            "config.database.port",
+            "config.database.host",
+            "config.ratio",
+            "config.debug",
+            "users[1].name",
+            "users[0].id",
+            "config.database"
+        )
+
+        val result = parseRaw(input).use { query.execute(it) }
+
+        assertEquals(5432L, result.getLong(0))
+        assertEquals("localhost", result.getString(1))
+        assertEquals(0.5, result.getDouble(2))
+        assertTrue(result.getBoolean(3))
+        assertEquals("Bob", result.getString(4))
+        assertEquals(1L, result[5])
+        assertEquals(mapOf("host" to "localhost", "port" to 5432), result[6])
+    }
+
+    @Test
+    fun `test missing paths and type mismatches`() {
+        val query = GblnQuery.of("config.nope", "users[5].id", "config.debug.x", "config.ratio")
+
+        val result = parseRaw(input).use { query.execute(it) }
+
+        assertFalse(result.isPresent(0))
+        assertFalse(result.isPresent(1))
+        assertFalse(result.isPresent(2))
+        assertNull(result[0])
+        assertEquals(7L, result.getLongOrDefault(1, 7L))
+        assertFailsWith<ValidationError> { result.getLong(0) }
+        assertFailsWith<ValidationError> { result.getLong(3) }
+    }
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import java.io.ByteArrayInputStream
+import java.nio.channels.Channels
+import java.nio.file.Paths
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class ReaderTest {
+
+    private val jvm = GblnParseOptions(engine = GblnEngine.JVM)
+
+    private fun reader(input: String, bufferSize: Int = 16) =
+        GblnReader(ByteArrayInputStream(input.toByteArray()), bufferSize)
+
+    private fun tokens(input: String): List<GblnToken> = reader(input).use { reader ->
+        generateSequence { reader.next().takeIf { it != GblnToken.END_DOCUMENT } }.toList()
+    }
+
+    @Test
+    fun `test event sequence`() {
+        assertEquals(
+            listOf(
+                GblnToken.START_OBJECT,
+                GblnToken.KEY, GblnToken.START_OBJECT,
+                GblnToken.KEY, GblnToken.VALUE,
+                GblnToken.KEY, GblnToken.START_ARRAY, GblnToken.VALUE, GblnToken.VALUE, GblnToken.END_ARRAY,
+                GblnToken.END_OBJECT,
+                GblnToken.KEY, GblnToken.START_ARRAY, GblnToken.START_OBJECT, GblnToken.END_OBJECT, GblnToken.END_ARRAY,
+                GblnToken.END_OBJECT
+            ),
+            tokens("user{id<u32>(1) tags<s8>[a b]} items[{}]")
+        )
+    }
+
+    @Test
+    fun `test typed accessors`() {
+        reader("a<i64>(-5) b<f32>(1.5) c<b>(t) d<s16>(hi\\)) e<n>() f<u64>[18446744073709551615]").use { r ->
+            r.next()
+            r.next(); assertEquals("a", r.key); r.next(); assertEquals(-5L, r.getLong()); assertEquals(-5, r.getInt())
+            r.next(); r.next(); assertEquals(1.5f, r.getFloat()); assertEquals(GblnValueType.F32, r.type)
+            r.next(); r.next(); assertTrue(r.getBoolean())
+            r.next(); r.next(); assertEquals("hi)", r.getString())
+            r.next(); r.next(); assertTrue(r.isNull)
+            r.next(); r.next(); assertEquals(GblnValueType.U64, r.elementType)
+            r.next(); assertEquals(-1L, r.getLong()); assertFailsWith<ValidationError> { r.getInt() }
+            assertFailsWith<ValidationError> { r.getString() }
+        }
+    }
+
+    @Test
+    fun `test readValue matches parse on fixtures at any buffer size`() {
+        val fixtures = listOf("/valid_nested.gbln", "/valid_array.gbln", "/fixtures/valid/types.gbln")
+        for (fixture in fixtures) {
+            val path = Paths.get(javaClass.getResource(fixture)!!.toURI())
+            val expected = parseFile(path, jvm)
+            for (bufferSize in listOf(16, 17, 100, GblnReader.DEFAULT_BUFFER_SIZE)) {
+                GblnReader.open(path, bufferSize).use { reader ->
+                    reader.next()
+                    assertEquals(expected, reader.readValue(), "$fixture, buffer $bufferSize")
+                    assertEquals(GblnToken.END_DOCUMENT, reader.next())
+                }
+            }
+        }
+    }
+
+    @Test
+    fun `test skipValue`() {
+        reader("a{x<i8>(1) y[{z<s8>(q)}]} b<i8>(2)").use { r ->
+            r.next()
+            r.next()
+            r.skipValue()
+            assertEquals(GblnToken.KEY, r.next())
+            assertEquals("b", r.key)
+            r.next()
+            assertEquals(2, r.getInt())
+            assertEquals(GblnToken.END_OBJECT, r.next())
+            assertEquals(0, r.depth)
+        }
+    }
+
+    @Test
+    fun `test errors match the JVM parser`() {
+        val inputs = listOf(
+            "user{name<s32>(Alice)",
+            "user{age<i8>(999)}",
+            "a<i8>(1) a<i8>(2)",
+            "a<s4>(hello)",
+            "a<x9>(1)",
+            "a<s8>(open",
+            "a<i8>[1 2",
+            "a<s2>(" + "x".repeat(100) + ")",
+            "a{} }"
+        )
+        for (input in inputs) {
+            val expected = assertFailsWith<ParseError>(input) { parse(input, jvm) }.code
+            val actual = assertFailsWith<ParseError>(input) {
+                reader(input).use { r -> while (r.next() != GblnToken.END_DOCUMENT) r.readValue() }
+            }.code
+            assertEquals(expected, actual, input)
+        }
+    }
+
+    @Test
+    fun `test long keys and padded payloads are accepted like parse`() {
+        val inputs = listOf(
+            "k".repeat(70_000) + "<i32>(1)",
+            "a<f64>(" + "0".repeat(2000) + "1.5) b<i32>(" + " ".repeat(2000) + "7)"
+        )
+        for (input in inputs) {
+            val expected = parse(input, jvm)
+            reader(input).use { r ->
+                r.next()
+                assertEquals(expected, r.readValue())
+            }
+        }
+    }
+
+    @Test
+    fun `test channel source and close`() {
+        val bytes = "n<i32>(7) :| comment\n".toByteArray()
+        val reader = GblnReader(Channels.newChannel(ByteArrayInputStream(bytes)))
+        reader.next()
+        assertEquals(mapOf("n" to 7), reader.readValue())
+        assertNull(reader.key)
+        reader.close()
+        reader.close()
+        assertFailsWith<IllegalStateException> { reader.next() }
+    }
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import java.io.ByteArrayInputStream
+import java.util.concurrent.ForkJoinPool
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class RecordStreamTest {
+
+    private val jvm = GblnParseOptions(engine = GblnEngine.JVM)
+
+    private fun stream(input: String, batchSize: Int = 64, lookAhead: Int = 3) =
+        GblnRecordStream(ByteArrayInputStream(input.toByteArray()), jvm, ForkJoinPool.commonPool(), lookAhead, batchSize)
+
+    @Test
+    fun `test records are returned in input order`() {
+        val lines = (0 until 2000).map { "id<u32>($it) name<s16>(event $it) tags<s8>[a b]" }
+        val records = stream(lines.joinToString("\n")).use { it.asSequence().toList() }
+        assertEquals(lines.map { parse(it, jvm) }, records)
+    }
+
+    @Test
+    fun `test blank lines and long lines`() {
+        val long = "data<s1024>(" + "x".repeat(1000) + ")"
+        val input = "\n  a<i8>(1)\r\n\n   \n{b<i8>(2)}\n$long\n:| only a comment\n"
+        val records = stream(input, batchSize = 16).use { it.asSequence().toList() }
+        assertEquals(listOf(parse("a<i8>(1)", jvm), parse("{b<i8>(2)}", jvm), parse(long, jvm), parse("", jvm)), records)
+    }
+
+    @Test
+    fun `test invalid record reports its line and iteration continues`() {
+        val lines = (1..500).map { if (it == 321) "x<i8>(300)" else "x<i8>(${it % 100})" }
+        stream(lines.joinToString("\n")).use { records ->
+            repeat(320) { records.next() }
+            val error = assertFailsWith<ParseError> { records.next() }
+            assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, error.code)
+            assertTrue(error.message!!.contains("line 321"), error.message)
+            assertEquals(mapOf("x" to 22), records.next())
+            assertEquals(179, records.asSequence().count())
+            assertFalse(records.hasNext())
+        }
+    }
+
+    @Test
+    fun `test empty input and close`() {
+        val records = stream("")
+        assertFalse(records.hasNext())
+        assertFailsWith<NoSuchElementException> { records.next() }
+        records.close()
+        records.close()
+        assertFailsWith<IllegalStateException> { records.hasNext() }
+    }
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.random.Random
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class ScalarsTest {
+
+    private fun integer(type: Int, text: String): Long {
+        val bytes = text.toByteArray()
+        return GblnScalars.parseInteger(type, bytes, 0, bytes.size)
+    }
+
+    private fun integerError(type: Int, text: String): Int =
+        assertFailsWith<GblnSyntaxException>(text) { integer(type, text) }.code
+
+    private fun assertDouble(text: String) {
+        val bytes = text.toByteArray()
+        assertEquals(text.toDouble().toRawBits(), GblnScalars.parseDouble(bytes, 0, bytes.size).toRawBits(), text)
+    }
+
+    private fun assertFloat(text: String) {
+        val bytes = text.toByteArray()
+        assertEquals(text.toFloat().toRawBits(), GblnScalars.parseFloat(bytes, 0, bytes.size).toRawBits(), text)
+    }
+
+    @Test
+    fun `test eight digits`() {
+        assertEquals(12345678, DecimalKernels.eightDigits("12345678".toByteArray(), 0))
+        assertEquals(0, DecimalKernels.eightDigits("x00000000".toByteArray(), 1))
+        assertEquals(99999999, DecimalKernels.eightDigits("99999999".toByteArray(), 0))
+        for (bad in listOf("1234567/", "1234567:", "1234 678", "-2345678", "1234567¹")) {
+            assertEquals(-1, DecimalKernels.eightDigits(bad.toByteArray(Charsets.ISO_8859_1), 0), bad)
+        }
+    }
+
+    @Test
+    fun `test integer ranges`() {
+        val cases = listOf(
+            GblnValueType.I8 to (Byte.MIN_VALUE.toLong()..Byte.MAX_VALUE.toLong()),
+            GblnValueType.I16 to (Short.MIN_VALUE.toLong()..Short.MAX_VALUE.toLong()),
+            GblnValueType.I32 to (Int.MIN_VALUE.toLong()..Int.MAX_VALUE.toLong()),
+            GblnValueType.U8 to (0L..0xFFL),
+            GblnValueType.U16 to (0L..0xFFFFL),
+            GblnValueType.U32 to (0L..0xFFFFFFFFL)
+        )
+        for ((type, range) in cases) {
+            assertEquals(range.first, integer(type, range.first.toString()))
+            assertEquals(range.last, integer(type, " +${range.last} "))
+            assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, integerError(type, (range.first - 1).toString()))
+            assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, integerError(type, (range.last + 1).toString()))
+        }
+
+        assertEquals(Long.MIN_VALUE, integer(GblnValueType.I64, "-9223372036854775808"))
+        assertEquals(Long.MAX_VALUE, integer(GblnValueType.I64, "9223372036854775807"))
+        assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, integerError(GblnValueType.I64, "9223372036854775808"))
+        assertEquals(-1L, integer(GblnValueType.U64, "18446744073709551615"))
+        assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, integerError(GblnValueType.U64, "18446744073709551616"))
+        assertEquals(0L, integer(GblnValueType.U8, "-0"))
+        assertEquals(42L, integer(GblnValueType.I8, "0000000000000000000000000042"))
+    }
+
+    @Test
+    fun `test integer syntax errors`() {
+        for (text in listOf("", "-", "+", "1 2", "12345678x", "123456789012345678x", "0x10", "1.0", "--1")) {
+            assertEquals(GblnErrorCode.ERROR_TYPE_MISMATCH, integerError(GblnValueType.I64, text), text)
+        }
+        // Overflow before the bad character is reported as overflow, as before
+        assertEquals(GblnErrorCode.ERROR_INT_OUT_OF_RANGE, integerError(GblnValueType.U64, "99999999999999999999x"))
+        assertEquals(GblnErrorCode.ERROR_TYPE_MISMATCH, integerError(GblnValueType.U64, "1844674407370955161x"))
+    }
+
+    @Test
+    fun `test random integers match toLong`() {
+        val random = Random(23)
+        repeat(100_000) {
+            val value = random.nextLong() shr random.nextInt(64)
+            assertEquals(value, integer(GblnValueType.I64, value.toString()))
+            val unsigned = value.toULong().toString()
+            assertEquals(value, integer(GblnValueType.U64, unsigned))
+        }
+    }
+
+    @Test
+    fun `test float edge cases match the JDK`() {
+        val cases = listOf(
+            "0", "-0", "0.0", ".5", "5.", "+1", "1e0", "1E+2", "1e-2",
+            "9007199254740992", "9007199254740993", "9007199254740995", "1e23", "8.98846567431158e307",
+            "1.7976931348623157e308", "1.7976931348623158e308", "1.8e308", "1e309", "1e-400",
+            "2.2250738585072011e-308", "2.2250738585072012e-308", "2.2250738585072014e-308",
+            "4.9e-324", "2.4703282292062327e-324", "2.4703282292062328e-324", "5e-324",
+            "3.4028235e38", "3.4028236e38", "1.17549435e-38", "1.4e-45", "7.038531e-26",
+            "0.1", "0.2", "0.3", "123456789012345678", "1234567890123456789", "12345678901234567890",
+            "0.000000000000000000000000000000000000000000001", "1" + "0".repeat(400) + "e-400",
+            "3.14159265358979323846264338327950288", "1e99999999999", "1e-99999999999"
+        )
+        for (text in cases) {
+            assertDouble(text)
+            assertFloat(text)
+            assertDouble("-$text".replace("--", "-").replace("-+", "-"))
+        }
+    }
+
+    @Test
+    fun `test random floats match toDouble and toFloat`() {
+        val random = Random(42)
+        repeat(200_000) {
+            val d = Double.fromBits(random.nextLong())
+            if (d.isFinite()) {
+                assertDouble(d.toString())
+                assertFloat(d.toString())
+            }
+            val f = Float.fromBits(random.nextInt())
+            if (f.isFinite()) {
+                assertFloat(f.toString())
+                assertDouble(f.toString())
+            }
+            val digits = (1..random.nextInt(1, 22)).joinToString("") { random.nextInt(10).toString() }
+            val text = "$digits.${random.nextInt(1000)}e${random.nextInt(-350, 320)}"
+            assertDouble(text)
+            assertFloat(text)
+        }
+    }
+
+    @Test
+    fun `test float syntax errors`() {
+        for (text in listOf("", ".", "-", "e5", "1e", "1e+", "1.2.3", "NaN", "Infinity", "0x1p3", "1f", "1d", "1 2")) {
+            val bytes = text.toByteArray()
+            val error = assertFailsWith<GblnSyntaxException>(text) { GblnScalars.parseDouble(bytes, 0, bytes.size) }
+            assertEquals(GblnErrorCode.ERROR_TYPE_MISMATCH, error.code)
+        }
+    }
+}
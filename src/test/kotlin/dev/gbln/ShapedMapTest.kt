@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertIs
+import kotlin.test.assertNull
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class ShapedMapTest {
+
+    private val compact = GblnParseOptions(compactObjects = true, engine = GblnEngine.JVM)
+
+    private fun decode(input: String): Any? = parse(input, compact)
+
+    private fun record(vararg fields: Pair<String, Int>): String =
+        fields.joinToString(" ", "{", "}") { (key, value) -> "$key<i32>($value)" }
+
+    @Test
+    fun `test records with the same keys share one shape`() {
+        val records = listOf(record("id" to 1, "age" to 30), record("id" to 2, "age" to 40), record("age" to 50, "id" to 3))
+        val data = (decode("r[${records.joinToString(" ")}]") as Map<*, *>)["r"] as List<*>
+
+        val first = assertIs<ShapedMap>(data[0])
+        val second = assertIs<ShapedMap>(data[1])
+        val third = assertIs<ShapedMap>(data[2])
+        assertSame(first.shape, second.shape)
+        // Key order is part of the shape
+        assertFalse(first.shape === third.shape)
+
+        assertEquals(mapOf("id" to 2, "age" to 40), second)
+        assertEquals(listOf("age", "id"), third.keys.toList())
+        assertEquals(mapOf("id" to 3, "age" to 50).hashCode(), third.hashCode())
+    }
+
+    @Test
+    fun `test large shape uses hash index`() {
+        val fields = (0 until 20).map { "field$it" to it }.toTypedArray()
+        val map = (decode("r${record(*fields)}") as Map<*, *>)["r"] as Map<*, *>
+
+        assertEquals(20, map.size)
+        assertEquals(13, map["field13"])
+        assertTrue(map.containsKey("field19"))
+        assertNull(map["field20"])
+        assertEquals(fields.map { it.first }, map.keys.toList())
+    }
+
+    @Test
+    fun `test repeated keys fall back to LinkedHashMap`() {
+        // Parsers reject duplicate keys; the shape table still handles them
+        val table = ShapeTable()
+        val map = table.build(table.root.next("a").next("b").next("a"), arrayOf<Any?>(1, 2, 3))
+
+        assertIs<LinkedHashMap<*, *>>(map)
+        assertEquals(mapOf("a" to 3, "b" to 2), map)
+    }
+
+    @Test
+    fun `test compact and classic conversion are equal`() {
+        val input = "name<s8>(Alice) scores[${record("x" to 1)}]"
+
+        assertEquals(parse(input, GblnParseOptions(engine = GblnEngine.JVM)), decode(input))
+    }
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import com.sun.jna.Memory
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNotSame
+import kotlin.test.assertSame
+
+class StringValuesTest {
+
+    private fun nativeString(value: String): Memory {
+        val bytes = value.toByteArray(Charsets.UTF_8)
+        return Memory(bytes.size + 1L).apply {
+            write(0, bytes, 0, bytes.size)
+            setByte(bytes.size.toLong(), 0)
+        }
+    }
+
+    @Test
+    fun `test native strings decode`() {
+        val texts = listOf(
+            "", "ok", "Zürich", "ÿ", "naïve café", "€", "日本語", "a😀b", "é€",
+            "x".repeat(255), "x".repeat(256), "y".repeat(1000) + "ß", "ß".repeat(300)
+        )
+        for (text in texts) {
+            nativeString(text).use { assertEquals(text, StringValues.read(it, dedup = false), text) }
+            nativeString(text).use { assertEquals(text, StringValues.read(it, dedup = true), text) }
+        }
+    }
+
+    @Test
+    fun `test dedup returns one instance`() {
+        val bytes = "xxactivexx".toByteArray()
+        val first = StringValues.decode(bytes, 2, 6, dedup = true)
+
+        assertEquals("active", first)
+        assertSame(first, StringValues.decode("active".toByteArray(), 0, 6, dedup = true))
+        nativeString("active").use { assertSame(first, StringValues.read(it, dedup = true)) }
+        assertNotSame(first, StringValues.decode(bytes, 2, 6, dedup = false))
+    }
+
+    @Test
+    fun `test long values are not deduplicated`() {
+        val value = "h".repeat(StringValues.MAX_DEDUP_BYTES + 1)
+        val bytes = value.toByteArray()
+
+        val first = StringValues.decode(bytes, 0, bytes.size, dedup = true)
+        assertEquals(value, first)
+        assertNotSame(first, StringValues.decode(bytes, 0, bytes.size, dedup = true))
+    }
+
+    @Test
+    fun `test parse option shares repeated values`() {
+        val input = "rows[{status<s8>(active) cc<s2>(DE)} {status<s8>(active) cc<s2>(DE)}]"
+        val options = GblnParseOptions(engine = GblnEngine.JVM, dedupStrings = true)
+        val rows = (parse(input, options) as Map<*, *>)["rows"] as List<*>
+        val first = rows[0] as Map<*, *>
+        val second = rows[1] as Map<*, *>
+
+        assertEquals("active", first["status"])
+        assertSame(first["status"], second["status"])
+        assertSame(first["cc"], second["cc"])
+        assertEquals(parse(input, GblnParseOptions(engine = GblnEngine.JVM)), parse(input, options))
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.random.Random
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class StructuralIndexTest {
+
+    private fun positions(index: StructuralIndex) = index.positions.copyOf(index.size)
+
+    @Test
+    fun `test scalar scanner finds every delimiter`() {
+        val input = "a{b<i8>(1) c[x] d\\)}| :| x".toByteArray()
+        val expected = input.indices.filter { input[it].toInt().toChar() in "{}[]()<>\\:" }.toIntArray()
+
+        assertContentEquals(expected, positions(ScalarStructuralScanner.scan(input, 0, input.size)))
+    }
+
+    @Test
+    fun `test selected scanner matches scalar on random input`() {
+        val random = Random(17)
+        val alphabet = "{}[]()<>\\|:;^{ab \n}".toByteArray() + byteArrayOf(0x7B, 0x7C, 0x7D, 0x5B, 0x5D, 0xDB.toByte(), 0xFB.toByte())
+
+        for (length in listOf(0, 1, 31, 32, 33, 63, 64, 65, 200, 4099)) {
+            val input = ByteArray(length) { alphabet[random.nextInt(alphabet.size)] }
+            for (from in listOf(0, minOf(3, length))) {
+                assertContentEquals(
+                    positions(ScalarStructuralScanner.scan(input, from, length)),
+                    positions(structuralScanner.scan(input, from, length)),
+                    "${structuralScanner.name}, length $length, from $from"
+                )
+            }
+        }
+    }
+
+    @Test
+    fun `test indexed parse matches unindexed parse`() {
+        val input = (
+            "a<s64>(x\\)y\\\\) b{c<s16>(<[{}]>) d<i8>[1 2 3]} :| comment ( ] }\n" +
+                "e[{f<s8>(g)} {f<s8>(h)}] t<b>(t)"
+            ).toByteArray()
+        val index = structuralScanner.scan(input, 0, input.size)
+
+        val indexed = JvmParser(input, 0, input.size, index).parse().root.toKotlin()
+        assertEquals(JvmParser(input).parse().root.toKotlin(), indexed)
+        assertEquals("x)y\\", (indexed as Map<*, *>)["a"])
+    }
+
+    @Test
+    fun `test indexed parse reports unterminated payload`() {
+        val input = "a<s8>(abc\\)".toByteArray()
+        val index = structuralScanner.scan(input, 0, input.size)
+
+        val error = assertFailsWith<GblnSyntaxException> { JvmParser(input, 0, input.size, index).parse() }
+        assertEquals(GblnErrorCode.ERROR_UNTERMINATED_STRING, error.code)
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertIs
+import kotlin.test.assertNotEquals
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class TryParseTest {
+
+    @Test
+    fun `test invalid input is a Failure with code and message`() {
+        val result = tryParse("user{age<i8>(999)}")
+
+        val failure = assertIs<GblnParseResult.Failure>(result)
+        assertNotEquals(GblnErrorCode.OK, failure.code)
+        assertTrue(failure.message.isNotEmpty())
+        assertNull(result.getOrNull())
+        assertEquals(failure.code, assertFailsWith<ParseError> { result.getOrThrow() }.code)
+    }
+
+    @Test
+    fun `test valid input is a Success`() {
+        val result = tryParse("a<i32>(1) b<s8>(hi)")
+
+        assertTrue(result.isSuccess)
+        assertEquals(mapOf("a" to 1, "b" to "hi"), result.getOrThrow())
+    }
+
+    @Test
+    fun `test parseOrNull and byte input`() {
+        assertNull(parseOrNull("user{"))
+        assertNotNull(parseOrNull("a<i32>(1) b<i32>(2)".toByteArray()))
+        assertIs<GblnParseResult.Failure>(tryParseRaw("user{".toByteArray()))
+    }
+
+    @Test
+    fun `test parse error carries the parser's code`() {
+        val failure = assertIs<GblnParseResult.Failure>(tryParse("user{age<i8>(999)}"))
+        val error = assertFailsWith<ParseError> { parse("user{age<i8>(999)}") }
+
+        assertEquals(failure.code, error.code)
+        assertEquals(failure.message, error.message)
+    }
+
+    @Test
+    fun `test fast-failure mode skips the stack trace`() {
+        try {
+            GblnErrors.fastFail = true
+            assertEquals(0, assertFailsWith<ParseError> { parse("user{") }.stackTrace.size)
+
+            GblnErrors.fastFail = false
+            assertTrue(assertFailsWith<ParseError> { parse("user{") }.stackTrace.isNotEmpty())
+        } finally {
+            GblnErrors.fastFail = false
+        }
+    }
+}
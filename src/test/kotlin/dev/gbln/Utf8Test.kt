@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.random.Random
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class Utf8Test {
+
+    private val counters = listOf(SwarUtf8Counter, utf8Counter)
+
+    private fun assertCounts(text: String) {
+        val bytes = text.toByteArray()
+        val expected = text.codePointCount(0, text.length)
+        for (counter in counters) {
+            assertEquals(expected, counter.count(bytes, 0, bytes.size), "${counter.name}: $text")
+        }
+    }
+
+    private fun assertInvalid(bytes: ByteArray) {
+        for (counter in counters) {
+            assertEquals(-1, counter.count(bytes, 0, bytes.size), "${counter.name}: ${bytes.joinToString { "%02X".format(it) }}")
+        }
+    }
+
+    private fun bytes(vararg values: Int) = ByteArray(values.size) { values[it].toByte() }
+
+    @Test
+    fun `test counts code points`() {
+        for (text in listOf("", "a", "hello", "äöüß", "€", "日本語テキスト", "😀👍", "a€😀ä".repeat(40), "x".repeat(200))) {
+            assertCounts(text)
+        }
+        assertCounts(String(Character.toChars(0x10FFFF)) + "퟿")
+    }
+
+    @Test
+    fun `test random text at every offset`() {
+        val random = Random(24)
+        val alphabet = listOf("a", " ", "é", "ß", "€", "中", "😀", String(Character.toChars(0x10FFFF)))
+        repeat(200) {
+            val length = random.nextInt(300)
+            val text = buildString {
+                // Mostly ASCII, as in real payloads
+                repeat(length) { append(if (random.nextInt(4) == 0) alphabet.random(random) else "k") }
+            }
+            val payload = text.toByteArray()
+            val from = random.nextInt(70)
+            val padded = ByteArray(from) { 'x'.code.toByte() } + payload + bytes(0xE2, 0x82)
+            for (counter in counters) {
+                assertEquals(
+                    text.codePointCount(0, text.length),
+                    counter.count(padded, from, from + payload.size),
+                    "${counter.name}, from $from"
+                )
+            }
+        }
+    }
+
+    @Test
+    fun `test rejects malformed sequences`() {
+        val cases = listOf(
+            bytes(0x80), // stray continuation
+            bytes(0x61, 0xBF, 0x62),
+            bytes(0xC0, 0xAF), // overlong
+            bytes(0xC1, 0xBF),
+            bytes(0xE0, 0x9F, 0xBF),
+            bytes(0xF0, 0x8F, 0xBF, 0xBF),
+            bytes(0xED, 0xA0, 0x80), // surrogate
+            bytes(0xF4, 0x90, 0x80, 0x80), // above U+10FFFF
+            bytes(0xF5, 0x80, 0x80, 0x80),
+            bytes(0xFF),
+            bytes(0xC3), // truncated
+            bytes(0xE2, 0x82),
+            bytes(0xF0, 0x9F, 0x98),
+            bytes(0xC3, 0x61),
+            bytes(0xE2, 0x82, 0xAC, 0xAC) // one continuation too many
+        )
+        for (case in cases) {
+            assertInvalid(case)
+            // Same error inside ASCII, and across every vector boundary
+            for (prefix in listOf(1, 31, 62, 63, 127)) {
+                assertInvalid(ByteArray(prefix) { 'a'.code.toByte() } + case + "tail".toByteArray())
+            }
+        }
+    }
+
+    @Test
+    fun `test truncation at end of range`() {
+        val bytes = ("a".repeat(63) + "€").toByteArray()
+        for (counter in counters) {
+            assertEquals(64, counter.count(bytes, 0, bytes.size), counter.name)
+            assertEquals(-1, counter.count(bytes, 0, bytes.size - 1), counter.name)
+            assertEquals(-1, counter.count(bytes, 1, bytes.size - 2), counter.name)
+        }
+    }
+
+    @Test
+    fun `test invalid UTF-8 rejected by JVM parser`() {
+        val jvm = GblnParseOptions(engine = GblnEngine.JVM)
+        val input = "a<s8>(".toByteArray() + bytes(0x61, 0xC3, 0x41) + ")".toByteArray()
+        val error = assertFailsWith<ParseError> { parse(input, 0, input.size, options = jvm) }
+        assertEquals(GblnErrorCode.ERROR_UNEXPECTED_CHAR, error.code)
+    }
+}
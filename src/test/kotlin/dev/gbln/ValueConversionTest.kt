@@ -4,6 +4,7 @@
 package dev.gbln
 
 import org.junit.jupiter.api.Test
+import kotlin.test.assertContentEquals
 import kotlin.test.assertEquals
 import kotlin.test.assertNotNull
 import kotlin.test.assertNull
@@ -198,4 +199,18 @@ class ValueConversionTest {
         assertEquals("你好", unicode["chinese"])
         assertEquals("Größe", unicode["german"])
     }
+
+    @Test
+    fun `test convert typed arrays to primitive arrays`() {
+        val options = GblnParseOptions(primitiveArrays = true)
+        val data = parse("data{scores<u8>[95 87 92 88 100]prices<f32>[19.99 29.99]ids<i64>[1 2 3]flags<b>[t f]empty<u32>[]}", options)
+        assertNotNull(data)
+        @Suppress("UNCHECKED_CAST")
+        val obj = data as Map<String, Any?>
+        assertContentEquals(shortArrayOf(95, 87, 92, 88, 100), obj["scores"] as ShortArray)
+        assertContentEquals(floatArrayOf(19.99f, 29.99f), obj["prices"] as FloatArray)
+        assertContentEquals(longArrayOf(1, 2, 3), obj["ids"] as LongArray)
+        assertContentEquals(booleanArrayOf(true, false), obj["flags"] as BooleanArray)
+        assertTrue((obj["empty"] as List<*>).isEmpty())
+    }
 }
@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Vivian Burkhard Voss
+// SPDX-License-Identifier: Apache-2.0
+
+package dev.gbln
+
+import org.junit.jupiter.api.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+
+class WarmupTest {
+
+    @Test
+    fun `test warmup reports every phase`() {
+        val report = Gbln.warmup(iterations = 3)
+
+        assertEquals(3, report.iterations)
+        assertEquals(gblnBackend, report.backend)
+        assertTrue(report.parseNanos > 0)
+        assertTrue(report.convertNanos > 0)
+        assertEquals(
+            report.loadNanos + report.bindNanos + report.parseNanos + report.convertNanos,
+            report.totalNanos
+        )
+    }
+
+    @Test
+    fun `test warmup rejects zero iterations`() {
+        assertFailsWith<IllegalArgumentException> { Gbln.warmup(iterations = 0) }
+    }
+}